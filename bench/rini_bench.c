@@ -0,0 +1,640 @@
+/*******************************************************************************************
+*
+*   rini benchmark
+*
+*   Measures rini parsing, lookup, setters and saving performance on a synthetic config file,
+*   results are printed as a table and optionally written as JSON to track regressions
+*
+*   USAGE:
+*       rini_bench [options]
+*
+*       --keys <n>              Number of key-value entries (default: 10000)
+*       --value-size <n>        Text values length in characters (default: 16)
+*       --comments <percent>    Comment lines density, comment line before a key (default: 20)
+*       --descriptions <percent> Keys with value description (default: 50)
+*       --sections <n>          Number of sections, keys distributed evenly (default: 10)
+*       --iterations <n>        Samples measured per benchmark (default: 20)
+*       --seed <n>              Random generator seed, same seed generates same file (default: 1)
+*       --file <path>           Synthetic config file path (default: rini_bench.ini)
+*       --generate              Only generate synthetic config file, no benchmarks run
+*       --output <path>         Write results as JSON to file
+*       --verify                Only verify numbers parsing against strtoll()/strtoull()/strtod(), no benchmarks run
+*
+*   NOTE: Build with optimizations enabled (i.e. -DCMAKE_BUILD_TYPE=Release) for meaningful results
+*
+*   LICENSE: MIT
+*
+*   Copyright (c) 2022-2026 Ramon Santamaria (@raysan5)
+*
+*   Permission is hereby granted, free of charge, to any person obtaining a copy
+*   of this software and associated documentation files (the "Software"), to deal
+*   in the Software without restriction, including without limitation the rights
+*   to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*   copies of the Software, and to permit persons to whom the Software is
+*   furnished to do so, subject to the following conditions:
+*
+*   The above copyright notice and this permission notice shall be included in all
+*   copies or substantial portions of the Software.
+*
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*   SOFTWARE.
+*
+**********************************************************************************************/
+
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+    #define _POSIX_C_SOURCE 200112L     // Required for: clock_gettime()
+#endif
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+
+// NOTE: rini_save_to_memory() uses a static buffer, it must fit the synthetic config file
+#define RINI_MAX_TEXT_FILE_SIZE     (64*1024*1024)
+
+#define RINI_IMPLEMENTATION
+#include "rini.h"
+
+#if defined(_WIN32)
+#if defined(__cplusplus)
+extern "C" {
+#endif
+__declspec(dllimport) int __stdcall QueryPerformanceCounter(long long *lpPerformanceCount);
+__declspec(dllimport) int __stdcall QueryPerformanceFrequency(long long *lpFrequency);
+#if defined(__cplusplus)
+}
+#endif
+#endif
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#define MAX_BENCH_RESULTS       16
+#define MAX_BENCH_ITERATIONS  1000
+#define MAX_VERIFY_NUMBERS  200000
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Synthetic config generation options
+typedef struct {
+    unsigned int keys;          // Key-value entries count
+    unsigned int value_size;    // Text values length
+    unsigned int comments;      // Comment lines density (percent)
+    unsigned int descriptions;  // Keys with description (percent)
+    unsigned int sections;      // Sections count
+    unsigned int seed;          // Random generator seed
+} bench_config;
+
+// Benchmark result, timings per operation
+typedef struct {
+    const char *name;           // Benchmark name
+    unsigned int ops;           // Operations per sample
+    unsigned int bytes;         // Bytes processed per sample (0 if not applicable)
+    double min_ns;              // Minimum time per operation
+    double median_ns;           // Median time per operation
+    double mean_ns;             // Mean time per operation
+    double ops_per_sec;         // Throughput, operations per second (median)
+    double mb_per_sec;          // Throughput, megabytes per second (median), 0 if not applicable
+} bench_result;
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+static bench_result results[MAX_BENCH_RESULTS] = { 0 };
+static unsigned int result_count = 0;
+static double samples[MAX_BENCH_ITERATIONS] = { 0 };
+static unsigned int random_state = 1;
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+static double get_time(void);               // Get current time in seconds (monotonic, high resolution)
+static unsigned int get_random(unsigned int max); // Get random value in range [0, max), deterministic for seed
+static char *generate_config(bench_config config, unsigned int *size); // Generate synthetic config text
+static void add_result(const char *name, unsigned int iterations, unsigned int ops, unsigned int bytes); // Add result from measured samples
+static int compare_samples(const void *a, const void *b); // Compare samples for sorting
+static void print_results(void);            // Print results table
+static int save_results_json(const char *file_name, bench_config config, unsigned int file_size, unsigned int iterations); // Save results to JSON file
+static int verify_number(const char *number); // Verify number text parsing against C library, returns 0 if matching
+static int verify_numbers(unsigned int seed); // Verify boundary and random numbers parsing, returns mismatches count
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    bench_config config = { 10000, 16, 20, 50, 10, 1 };
+    unsigned int iterations = 20;
+    const char *file_name = "rini_bench.ini";
+    const char *output_file_name = NULL;
+    bool generate_only = false;
+    bool verify_only = false;
+
+    // Parse command line options
+    for (int i = 1; i < argc; i++)
+    {
+        bool has_value = (i + 1) < argc;
+
+        if ((strcmp(argv[i], "--keys") == 0) && has_value) config.keys = (unsigned int)strtoul(argv[++i], NULL, 10);
+        else if ((strcmp(argv[i], "--value-size") == 0) && has_value) config.value_size = (unsigned int)strtoul(argv[++i], NULL, 10);
+        else if ((strcmp(argv[i], "--comments") == 0) && has_value) config.comments = (unsigned int)strtoul(argv[++i], NULL, 10);
+        else if ((strcmp(argv[i], "--descriptions") == 0) && has_value) config.descriptions = (unsigned int)strtoul(argv[++i], NULL, 10);
+        else if ((strcmp(argv[i], "--sections") == 0) && has_value) config.sections = (unsigned int)strtoul(argv[++i], NULL, 10);
+        else if ((strcmp(argv[i], "--iterations") == 0) && has_value) iterations = (unsigned int)strtoul(argv[++i], NULL, 10);
+        else if ((strcmp(argv[i], "--seed") == 0) && has_value) config.seed = (unsigned int)strtoul(argv[++i], NULL, 10);
+        else if ((strcmp(argv[i], "--file") == 0) && has_value) file_name = argv[++i];
+        else if ((strcmp(argv[i], "--output") == 0) && has_value) output_file_name = argv[++i];
+        else if (strcmp(argv[i], "--generate") == 0) generate_only = true;
+        else if (strcmp(argv[i], "--verify") == 0) verify_only = true;
+        else
+        {
+            printf("Usage: %s [--keys n] [--value-size n] [--comments percent] [--descriptions percent]\n", argv[0]);
+            printf("       [--sections n] [--iterations n] [--seed n] [--file path] [--generate] [--output path] [--verify]\n");
+            return 1;
+        }
+    }
+
+    if (verify_only)
+    {
+        int mismatches = verify_numbers(config.seed);
+
+        if (mismatches == 0) printf("rini %s numbers verification: OK\n", RINI_VERSION);
+        else printf("rini %s numbers verification: %i mismatches\n", RINI_VERSION, mismatches);
+
+        return (mismatches == 0)? 0 : 1;
+    }
+
+    if (config.keys == 0) config.keys = 1;
+    if (iterations == 0) iterations = 1;
+    if (iterations > MAX_BENCH_ITERATIONS) iterations = MAX_BENCH_ITERATIONS;
+
+    // Generate synthetic config file
+    unsigned int size = 0;
+    char *text = generate_config(config, &size);
+
+    if (text == NULL)
+    {
+        printf("ERROR: Synthetic config could not be generated\n");
+        return 1;
+    }
+
+    FILE *file = fopen(file_name, "wb");
+    if ((file == NULL) || (fwrite(text, 1, size, file) != size))
+    {
+        printf("ERROR: Synthetic config could not be written: %s\n", file_name);
+        if (file != NULL) fclose(file);
+        free(text);
+        return 1;
+    }
+    fclose(file);
+
+    printf("rini %s benchmark: %u keys, %u sections, value size %u, comments %u%%, descriptions %u%%\n",
+        RINI_VERSION, config.keys, config.sections, config.value_size, config.comments, config.descriptions);
+    printf("Config file: %s (%u bytes), %u iterations\n\n", file_name, size, iterations);
+
+    if (generate_only)
+    {
+        free(text);
+        return 0;
+    }
+
+    // Keys used for lookups and setters, random order so lookups do not follow file order
+    unsigned int lookup_count = (config.keys < 100000)? config.keys : 100000;
+    char (*hit_keys)[32] = (char (*)[32])malloc(lookup_count*32);
+    char (*miss_keys)[32] = (char (*)[32])malloc(lookup_count*32);
+
+    for (unsigned int i = 0; i < lookup_count; i++)
+    {
+        snprintf(hit_keys[i], 32, "key_%u", get_random(config.keys));
+        snprintf(miss_keys[i], 32, "missing_key_%u", i);
+    }
+
+    const char *save_file_name = "rini_bench_save.ini";
+    volatile long long checksum = 0;    // Prevents results from being optimized out
+    rini_data data = { 0 };
+
+    // Loading benchmarks
+    for (unsigned int i = 0; i < iterations; i++)
+    {
+        double start = get_time();
+        data = rini_load(file_name);
+        samples[i] = get_time() - start;
+        checksum += data.count;
+        rini_unload(&data);
+    }
+    add_result("rini_load", iterations, 1, size);
+
+    for (unsigned int i = 0; i < iterations; i++)
+    {
+        double start = get_time();
+        data = rini_load_full(file_name);
+        samples[i] = get_time() - start;
+        checksum += data.count;
+        rini_unload(&data);
+    }
+    add_result("rini_load_full", iterations, 1, size);
+
+    for (unsigned int i = 0; i < iterations; i++)
+    {
+        double start = get_time();
+        data = rini_load_from_memory(text);
+        samples[i] = get_time() - start;
+        checksum += data.count;
+        rini_unload(&data);
+    }
+    add_result("rini_load_from_memory", iterations, 1, size);
+
+    // Lookup benchmarks, every sample looks up all keys
+    data = rini_load(file_name);
+
+    for (unsigned int i = 0; i < iterations; i++)
+    {
+        double start = get_time();
+        for (unsigned int k = 0; k < lookup_count; k++) checksum += rini_get_value_text(data, hit_keys[k])[0];
+        samples[i] = get_time() - start;
+    }
+    add_result("rini_get_value_text (hit)", iterations, lookup_count, 0);
+
+    for (unsigned int i = 0; i < iterations; i++)
+    {
+        double start = get_time();
+        for (unsigned int k = 0; k < lookup_count; k++) checksum += rini_get_value(data, hit_keys[k]);
+        samples[i] = get_time() - start;
+    }
+    add_result("rini_get_value (hit)", iterations, lookup_count, 0);
+
+    for (unsigned int i = 0; i < iterations; i++)
+    {
+        double start = get_time();
+        for (unsigned int k = 0; k < lookup_count; k++) checksum += rini_get_value(data, miss_keys[k]);
+        samples[i] = get_time() - start;
+    }
+    add_result("rini_get_value (miss)", iterations, lookup_count, 0);
+
+    // Saving benchmarks
+    for (unsigned int i = 0; i < iterations; i++)
+    {
+        double start = get_time();
+        rini_save(data, save_file_name);
+        samples[i] = get_time() - start;
+    }
+    add_result("rini_save", iterations, 1, rini_save_to_buffer(data, NULL, 0));
+
+    for (unsigned int i = 0; i < iterations; i++)
+    {
+        double start = get_time();
+        checksum += rini_save_to_memory(data)[0];
+        samples[i] = get_time() - start;
+    }
+    add_result("rini_save_to_memory", iterations, 1, rini_save_to_buffer(data, NULL, 0));
+
+    rini_unload(&data);
+
+    // Setters benchmarks, every sample uses a fresh loaded config (loading not measured)
+    for (unsigned int i = 0; i < iterations; i++)
+    {
+        data = rini_load(file_name);
+
+        double start = get_time();
+        for (unsigned int k = 0; k < lookup_count; k++) rini_set_value_text(&data, hit_keys[k], "updated value", NULL);
+        samples[i] = get_time() - start;
+
+        rini_unload(&data);
+    }
+    add_result("rini_set_value_text (update)", iterations, lookup_count, 0);
+
+    unsigned int add_count = (lookup_count < 1000)? lookup_count : 1000;
+
+    for (unsigned int i = 0; i < iterations; i++)
+    {
+        data = rini_load(file_name);
+
+        double start = get_time();
+        for (unsigned int k = 0; k < add_count; k++) rini_set_value(&data, miss_keys[k], (int)k, "new value");
+        samples[i] = get_time() - start;
+
+        rini_unload(&data);
+    }
+    add_result("rini_set_value (add)", iterations, add_count, 0);
+
+    // NOTE: Keys added to first section, values of next sections are moved (no keys index rebuild expected)
+    const char *add_section = (config.sections > 0)? "section_1" : NULL;
+
+    for (unsigned int i = 0; i < iterations; i++)
+    {
+        data = rini_load(file_name);
+
+        double start = get_time();
+        for (unsigned int k = 0; k < add_count; k++) rini_set_section_value(&data, add_section, miss_keys[k], (int)k, "new value");
+        samples[i] = get_time() - start;
+
+        rini_unload(&data);
+    }
+    add_result("rini_set_section_value (add)", iterations, add_count, 0);
+
+    print_results();
+
+    if ((output_file_name != NULL) && (save_results_json(output_file_name, config, size, iterations) == 0))
+    {
+        printf("\nResults saved: %s\n", output_file_name);
+    }
+
+    remove(save_file_name);
+    free(hit_keys);
+    free(miss_keys);
+    free(text);
+
+    return 0;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+// Get current time in seconds (monotonic, high resolution)
+static double get_time(void)
+{
+#if defined(_WIN32)
+    long long counter = 0;
+    long long frequency = 1;
+    QueryPerformanceCounter(&counter);
+    QueryPerformanceFrequency(&frequency);
+
+    return (double)counter/(double)frequency;
+#else
+    struct timespec now = { 0 };
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (double)now.tv_sec + (double)now.tv_nsec*1e-9;
+#endif
+}
+
+// Get random value in range [0, max), xorshift generator (deterministic for seed)
+static unsigned int get_random(unsigned int max)
+{
+    random_state ^= random_state << 13;
+    random_state ^= random_state >> 17;
+    random_state ^= random_state << 5;
+
+    return (max > 0)? (random_state%max) : 0;
+}
+
+// Generate synthetic config text
+// NOTE: Values types are mixed (integer, decimal, boolean and text), keys are distributed evenly into sections,
+// global section (before first section) gets same keys count as every section
+static char *generate_config(bench_config config, unsigned int *size)
+{
+    random_state = (config.seed != 0)? config.seed : 1;
+
+    // NOTE: Line size estimated for worst case: comment line, key, text value and description
+    unsigned int line_size = 256 + config.value_size*2;
+    unsigned int capacity = (config.keys + config.sections + 1)*line_size + 1;
+    char *text = (char *)malloc(capacity);
+    unsigned int offset = 0;
+
+    if (text != NULL)
+    {
+        unsigned int keys_per_section = config.keys/(config.sections + 1);
+        unsigned int section = 0;
+
+        offset += snprintf(text + offset, capacity - offset, "# rini synthetic config: %u keys, %u sections\n\n", config.keys, config.sections);
+
+        for (unsigned int i = 0; i < config.keys; i++)
+        {
+            // New section line, last section gets remaining keys
+            if ((section < config.sections) && (keys_per_section > 0) && (i > 0) && ((i%keys_per_section) == 0))
+            {
+                section++;
+                offset += snprintf(text + offset, capacity - offset, "\n[section_%u]\n", section);
+            }
+
+            if (get_random(100) < config.comments) offset += snprintf(text + offset, capacity - offset, "# Comment line for key_%u\n", i);
+
+            offset += snprintf(text + offset, capacity - offset, "key_%u ", i);
+
+            switch (get_random(4))
+            {
+                case 0: offset += snprintf(text + offset, capacity - offset, "%d", (int)get_random(2000000) - 1000000); break;
+                case 1: offset += snprintf(text + offset, capacity - offset, "%.3f", (double)get_random(1000000)/100.0); break;
+                case 2: offset += snprintf(text + offset, capacity - offset, "%s", get_random(2)? "true" : "false"); break;
+                default:
+                {
+                    text[offset++] = '\"';
+                    for (unsigned int c = 0; c < config.value_size; c++) text[offset++] = ((c%6) == 5)? ' ' : (char)('a' + get_random(26));
+                    text[offset++] = '\"';
+                } break;
+            }
+
+            if (get_random(100) < config.descriptions) offset += snprintf(text + offset, capacity - offset, " # Description for key_%u", i);
+
+            text[offset++] = '\n';
+        }
+
+        text[offset] = '\0';
+        *size = offset;
+    }
+
+    return text;
+}
+
+// Add result from measured samples (seconds per sample)
+static void add_result(const char *name, unsigned int iterations, unsigned int ops, unsigned int bytes)
+{
+    if (result_count < MAX_BENCH_RESULTS)
+    {
+        bench_result *result = &results[result_count];
+        double total = 0.0;
+
+        for (unsigned int i = 0; i < iterations; i++) total += samples[i];
+        qsort(samples, iterations, sizeof(double), compare_samples);
+
+        double median = ((iterations%2) == 0)? (samples[iterations/2 - 1] + samples[iterations/2])/2.0 : samples[iterations/2];
+
+        result->name = name;
+        result->ops = ops;
+        result->bytes = bytes;
+        result->min_ns = samples[0]*1e9/ops;
+        result->median_ns = median*1e9/ops;
+        result->mean_ns = total/iterations*1e9/ops;
+        result->ops_per_sec = (median > 0.0)? ops/median : 0.0;
+        result->mb_per_sec = ((bytes > 0) && (median > 0.0))? (bytes/(1024.0*1024.0))/median : 0.0;
+
+        result_count++;
+    }
+}
+
+// Compare samples for sorting
+static int compare_samples(const void *a, const void *b)
+{
+    double sa = *(const double *)a;
+    double sb = *(const double *)b;
+
+    return (sa > sb) - (sa < sb);
+}
+
+// Print results table
+static void print_results(void)
+{
+    printf("%-30s %14s %14s %14s %14s %10s\n", "benchmark", "min (ns/op)", "median (ns/op)", "mean (ns/op)", "ops/s", "MB/s");
+
+    for (unsigned int i = 0; i < result_count; i++)
+    {
+        const bench_result *result = &results[i];
+
+        printf("%-30s %14.1f %14.1f %14.1f %14.0f ", result->name, result->min_ns, result->median_ns, result->mean_ns, result->ops_per_sec);
+
+        if (result->bytes > 0) printf("%10.1f\n", result->mb_per_sec);
+        else printf("%10s\n", "-");
+    }
+}
+
+// Save results to JSON file, returns 0 on success
+static int save_results_json(const char *file_name, bench_config config, unsigned int file_size, unsigned int iterations)
+{
+    int result = -1;
+    FILE *file = fopen(file_name, "wt");
+
+    if (file != NULL)
+    {
+        fprintf(file, "{\n");
+        fprintf(file, "  \"rini_version\": \"%s\",\n", RINI_VERSION);
+        fprintf(file, "  \"config\": { \"keys\": %u, \"value_size\": %u, \"comments\": %u, \"descriptions\": %u, \"sections\": %u, \"seed\": %u, \"file_size\": %u, \"iterations\": %u },\n",
+            config.keys, config.value_size, config.comments, config.descriptions, config.sections, config.seed, file_size, iterations);
+        fprintf(file, "  \"results\": [\n");
+
+        for (unsigned int i = 0; i < result_count; i++)
+        {
+            const bench_result *res = &results[i];
+
+            fprintf(file, "    { \"name\": \"%s\", \"ops\": %u, \"bytes\": %u, \"min_ns\": %.1f, \"median_ns\": %.1f, \"mean_ns\": %.1f, \"ops_per_sec\": %.1f, \"mb_per_sec\": %.2f }%s\n",
+                res->name, res->ops, res->bytes, res->min_ns, res->median_ns, res->mean_ns, res->ops_per_sec, res->mb_per_sec, (i < (result_count - 1))? "," : "");
+        }
+
+        fprintf(file, "  ]\n}\n");
+
+        if (ferror(file) == 0) result = 0;
+        fclose(file);
+    }
+
+    return result;
+}
+
+// Verify number text parsing against C library, returns 0 if matching
+// NOTE: Expected type and value from strtoll()/strtoull() for integers (strtod() if out of range),
+// strtod() for decimals, double values compared bitwise (correctly rounded expected)
+static int verify_number(const char *number)
+{
+    char text[512] = { 0 };
+    snprintf(text, sizeof(text), "k %s\n", number);
+
+    rini_value_type type = RINI_VALUE_FLOAT;
+    long long int_value = 0;
+    unsigned long long uint_value = 0;
+    double float_value = strtod(number, NULL);
+
+    if (strpbrk(number, ".eE") == NULL)
+    {
+        errno = 0;
+        int_value = strtoll(number, NULL, 10);
+
+        if (errno == 0)
+        {
+            type = RINI_VALUE_INT;
+            float_value = (double)int_value;    // Integer zero has no sign
+        }
+        else if (number[0] != '-')
+        {
+            errno = 0;
+            uint_value = strtoull(number, NULL, 10);
+            if (errno == 0) type = RINI_VALUE_UINT;
+        }
+    }
+
+    rini_data data = rini_load_from_memory(text);
+
+    rini_value_type parsed_type = rini_get_value_type(data, "k");
+    long long parsed_int = 0;
+    unsigned long long parsed_uint = 0;
+    double parsed_float = 0.0;
+    bool valid = (parsed_type == type) && rini_try_get_value_double(data, "k", &parsed_float) &&
+        (memcmp(&parsed_float, &float_value, sizeof(double)) == 0);
+
+    if (valid && (type == RINI_VALUE_INT)) valid = rini_try_get_value_int64(data, "k", &parsed_int) && (parsed_int == int_value);
+    if (valid && (type == RINI_VALUE_UINT)) valid = rini_try_get_value_uint64(data, "k", &parsed_uint) && (parsed_uint == uint_value);
+
+    if (!valid) printf("MISMATCH: %s (type %i, expected %i, value %.17g, expected %.17g)\n", number, (int)parsed_type, (int)type, parsed_float, float_value);
+
+    rini_unload(&data);
+
+    return valid? 0 : 1;
+}
+
+// Verify boundary and random numbers parsing, returns mismatches count
+// NOTE: Random numbers: optional sign, leading zeros, up to 25 integer and decimal digits and exponent
+static int verify_numbers(unsigned int seed)
+{
+    static const char *boundaries[] = {
+        "0", "-0", "+0", "0.0", "-0.0", "000000000000000000000000001", "1.", ".5", "-.5",
+        "9223372036854775807", "9223372036854775808", "9223372036854775806",
+        "-9223372036854775808", "-9223372036854775809", "-9223372036854775807",
+        "+9223372036854775807", "09223372036854775808", "-09223372036854775808",
+        "18446744073709551615", "18446744073709551616", "18446744073709551614",
+        "99999999999999999999", "10000000000000000000", "100000000000000000000", "-18446744073709551615",
+        "9007199254740992", "9007199254740993", "9007199254740993.0", "9007199254740993e0",
+        "1e22", "1e23", "1.7976931348623157e308", "1.7976931348623158e308", "1.8e308", "1e309", "-1e309",
+        "2.2250738585072014e-308", "2.2250738585072011e-308", "4.9406564584124654e-324", "2.4703282292062328e-324",
+        "2.4703282292062327e-324", "1e-400", "1e100000", "1e-100000", "1e999999999", "0e999999999",
+        "0.1", "0.2", "0.3", "3.14159265358979323846264338327950288", "1.00000000000000011102230246251565404",
+        "123456789012345678901234567890", "0.000000000000000000000000000001234567890123456789012345",
+        "4503599627370496.5", "4503599627370497.5", "1797693134862315708145274237317043567980705675258449965989174768031572607800285387605895586327668781715404589535143824642343213268894641827684675467035375169860499105765512820762454900903893289440758685084551339423045832369032229481658085593321233482747978262041447231687381771809192998812504040261841248583680"
+    };
+
+    int mismatches = 0;
+    char number[128] = { 0 };
+
+    for (unsigned int i = 0; i < sizeof(boundaries)/sizeof(boundaries[0]); i++) mismatches += verify_number(boundaries[i]);
+
+    random_state = (seed != 0)? seed : 1;
+
+    for (unsigned int i = 0; i < MAX_VERIFY_NUMBERS; i++)
+    {
+        unsigned int length = 0;
+        unsigned int sign = get_random(4);
+        unsigned int zeros = (get_random(8) == 0)? get_random(4) : 0;
+        unsigned int int_digits = get_random(26);
+        unsigned int dec_digits = (get_random(2) == 0)? get_random(26) : 0;
+
+        if (sign == 1) number[length++] = '-';
+        else if (sign == 2) number[length++] = '+';
+
+        for (unsigned int k = 0; k < zeros; k++) number[length++] = '0';
+        for (unsigned int k = 0; k < int_digits; k++) number[length++] = (char)('0' + get_random(10));
+
+        if (dec_digits > 0)
+        {
+            number[length++] = '.';
+            for (unsigned int k = 0; k < dec_digits; k++) number[length++] = (char)('0' + get_random(10));
+        }
+
+        if ((zeros + int_digits + dec_digits) == 0) number[length++] = '0';
+
+        if (get_random(3) == 0)
+        {
+            length += (unsigned int)snprintf(number + length, sizeof(number) - length, "e%i", (int)get_random(700) - 350);
+        }
+
+        number[length] = '\0';
+
+        mismatches += verify_number(number);
+    }
+
+    return mismatches;
+}
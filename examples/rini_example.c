@@ -36,15 +36,22 @@
 
 #define INI_FILE "resources/rini_example.ini"
 
+// Window config fields: type, struct field, key, default value
+#define WINDOW_CONFIG(X) \
+    X(INT,  screen_width,  "screen_width",  800) \
+    X(INT,  screen_height, "screen_height", 450) \
+    X(TEXT, title,         "title",         "rini example")
+
+RINI_SCHEMA(window_config, WINDOW_CONFIG)
+
 int main(void)
 {
     rini_data config = rini_load(INI_FILE);
 
-    int screen_width  = rini_get_value_fallback(config, "screen_width",  800);
-    int screen_height = rini_get_value_fallback(config, "screen_height", 450);
-    const char *title = rini_get_value_text_fallback(config, "title", "rini example");
+    // NOTE: One lookup per field, missing (or misspelled) keys keep default values
+    window_config window = window_config_load(config);
 
-    InitWindow(screen_width, screen_height, title);
+    InitWindow(window.screen_width, window.screen_height, window.title);
     SetTargetFPS(60);
 
     while (!WindowShouldClose())
@@ -7,7 +7,21 @@
 *
 *   FEATURES:
 *       - Init/Config files reading and writing
-*       - Supported value types: int, string
+*       - Supported value types: int, int64, uint64, float/double, bool, string (typed once on loading/setting)
+*       - Fast locale-independent numbers parsing, with overflow detection
+*       - SIMD text scanning on loading (SSE2/AVX2), scalar fallback
+*       - Parallel loading of big files, using multiple threads (optional)
+*       - Streaming parsing (callback per line) from FILE*, file descriptor or custom reader, constant memory
+*       - Immutable snapshots with atomic publishing, lock-free readers for hot reloading (optional)
+*       - File changes watching, reloading only changed files (mtime/size, content hash), changed keys list
+*       - Data comparison (keys added/removed/modified) and three-way merge keeping comments and lines order
+*       - Compiled binary format (keys hash table, typed values, strings pool), memory-mapped with no parsing (optional)
+*       - Compile-time schema (X-macro), typed config struct filled once (one lookup per field), no keys lookup on access
+*       - Caller-owned memory arena per load, data released at once by arena reset (no individual frees)
+*       - Statistics counters (lookups, hits, misses, sets, truncations, bytes) and phases timing, tracing hook (optional)
+*       - Batch getter resolving many keys at once, with typed outputs and fallbacks
+*       - Keys handles resolved once for constant-time access (no key lookup), stale handles detected
+*       - Keys interning shared by many data (user-owned table), keys resolved once to ids valid for any data
 *       - Support comment lines and empty lines
 *       - Support custom line comment delimiter
 *       - Support custom value delimiters
@@ -15,12 +29,16 @@
 *       - Support custom description custom delimiter
 *       - Support multi-word text values w/o quote delimiters
 *       - Support custom key and value spacings
-*       - Customizable maximum values capacity
+*       - Support [sections], with section-scoped values access
+*       - Growable values capacity, with optional maximum limit
+*       - Constant-time keys lookup using a hash index (optional)
+*       - Fast buffered saving, single write per file
+*       - Crash-safe atomic saving, with optional sync to disk
+*       - Incremental saving, only changed lines patched into source file
 *       - Minimal C standard lib dependency (optional)
 *
 *   LIMITATIONS:
-*       - [sections] lines not supported
-*       - Saving file requires complete rewrite
+*       - rini_save() requires complete rewrite, rini_save_patch() only rewrites changed lines
 *
 *   POSSIBLE IMPROVEMENTS:
 *       - Support disabled key-value entries
@@ -31,28 +49,17 @@
 *           If not defined, the library is in header only mode and can be included in other headers
 *           or source files without problems. But only ONE file should hold the implementation.
 *
-*       #define RINI_MAX_LINE_SIZE
-*           Defines the maximum size of line buffer to read from file.
-*           Default value: 512 bytes (considering [key + text + desc] is 256 max size by default)
-*
-*       #define RINI_MAX_KEY_SIZE
-*           Defines the maximum size of value key
-*           Default value: 64 bytes
-*
-*       #define RINI_MAX_TEXT_SIZE
-*           Defines the maximum size of value text
-*           Default value: 256 bytes
-*
-*       #define RINI_MAX_DESC_SIZE
-*           Defines the maximum size of value description
-*           Default value: 256 bytes
+*       #define RINI_INITIAL_VALUE_CAPACITY
+*           Defines the initial number of values allocated, capacity grows geometrically when required
+*           Default value: 16 entries
 *
 *       #define RINI_MAX_VALUE_CAPACITY
-*           Defines the maximum number of values supported
-*           Default value: 256 entries support
+*           Defines the maximum number of values supported, additional values are not loaded/added
+*           Default value: 0 (no limit)
 *
 *       #define RINI_MAX_TEXT_FILE_SIZE
-*           Define the maximum size of the file that is saved in memory
+*           Define the maximum size of the file that is saved in memory (static buffer)
+*           NOTE: rini_save_to_buffer() does not have this limitation
 *           Default value: 4096 bytes
 *
 *       #define RINI_LINE_COMMENT_DELIMITER
@@ -61,8 +68,8 @@
 *           Default value: '#'
 *
 *       #define RINI_LINE_SECTION_DELIMITER
-*           Defines section lines start character
-*           Sections loading is not supported, lines are just skipped for now
+*           Defines section lines start character, section name ends with ']'
+*           Every section owns the values following it, until next section line
 *           Default value: '['
 *
 *       #define RINI_VALUE_DELIMITER
@@ -72,8 +79,8 @@
 *
 *       #define RINI_VALUE_QUOTATION_MARKS
 *           Defines quotation marks to be used around text values
-*           Text values are determined checking text with atoi(), only for integer values,
-*           in case of float values they are always considered as text
+*           Quoted values are saved as text, values type (int, float, bool, string) is resolved
+*           from value text independently of quotation marks
 *           Default value: '\"'
 *
 *       #define RINI_DESCRIPTION_DELIMITER
@@ -81,13 +88,99 @@
 *           This implementation allows adding inline comments after the value.
 *           Default value: '#'
 *
+*       #define RINI_USE_KEY_HASH_INDEX
+*           Use a keys hash index (open addressing) to lookup values, built on loading and updated by setters
+*           If disabled (0), values are looked-up with a linear scan comparing every key
+*           Default value: 1
+*
+*       #define RINI_SUPPORT_PARALLEL_LOAD
+*           Enables rini_load_parallel(), file is split in chunks (at lines boundaries) parsed by multiple threads,
+*           merged in file order, loaded data is the same as rini_load()
+*           NOTE: Requires threads library on POSIX platforms (pthreads, link with -pthread)
+*           Default value: not defined
+*
+*       #define RINI_PARALLEL_MIN_CHUNK_SIZE
+*           Defines the minimum chunk size to be parsed by a thread on parallel loading
+*           Default value: 65536 bytes
+*
+*       #define RINI_SUPPORT_SNAPSHOTS
+*           Enables read-only data snapshots (rini_snapshot) shared between threads (rini_shared),
+*           a new snapshot is published atomically (hot reload) while readers acquire/release current one without locks,
+*           old snapshots are unloaded when released by last reader
+*           NOTE: Requires atomic operations support (GCC/Clang builtins or MSVC intrinsics)
+*           Default value: not defined
+*
+*       #define RINI_SUPPORT_BINARY
+*           Enables compiled binary format (rini_binary), data is saved into a versioned position-independent
+*           binary file (keys hash tables, typed values, strings pool, checksum), that is loaded memory-mapped
+*           and queried directly, no parsing or allocations required, mapped pages are shared between processes
+*           Default value: not defined
+*
+*       #define RINI_SUPPORT_STATS
+*           Enables statistics for every loaded data (rini_get_stats()): lookups, hits, misses, sets, appends,
+*           truncations, bytes read/written and phases durations (read, parse, index, save),
+*           and a tracing callback (rini_set_trace_callback()) for phases spans and keys lookups
+*           Default value: not defined
+*
+*       #define RINI_USE_SIMD
+*           Use SIMD instructions to scan text on loading (AVX2 32-byte or SSE2 16-byte blocks),
+*           detected from compiler target (i.e. -mavx2), byte by byte scanning used if disabled/not supported
+*           Default value: 1
+*
+*       #define RINI_STREAM_BUFFER_SIZE
+*           Defines the initial text buffer size used by streaming parsing, stream is read in blocks of this size
+*           NOTE: Buffer only grows in case a line does not fit in it
+*           Default value: 4096 bytes
+*
+*       #define RINI_USE_SAVE_FILE_SYNC
+*           Flush saved file (and its directory) to disk before replacing original file with rini_save_atomic()
+*           Slower, but saved data survives a system crash, not only a process crash
+*           Default value: 0 (disabled)
+*
+*       #define RINI_SAVE_TEMP_FILE_EXT
+*           Defines the temporary file extension used by rini_save_atomic(), appended to file name
+*           Default value: ".tmp"
+*
 *   DEPENDENCIES: C standard library:
-*       - stdio.h: fopen(), feof(), fgets(), fclose(), fprintf()
-*       - stdlib.h: malloc(), calloc(), free()
-*       - string.h: memset(), memcpy(), strcmp(), strlen()
+*       - stdio.h: fopen(), fseek(), ftell(), fread(), fwrite(), fflush(), fclose(), ferror(), rename(), remove(), snprintf()
+*       - stdlib.h: malloc(), calloc(), free(), strtod()
+*       - stddef.h: offsetof() [RINI_SCHEMA()]
+*       - string.h: memset(), memcpy(), memmove(), memchr(), strcmp(), strrchr(), strlen()
+*       - unistd.h: read() [POSIX], io.h: _read() [Windows]
+*       - time.h: time()
+*       - sys/stat.h: stat()
+*       - pthread.h, unistd.h: pthread_create(), pthread_join(), sysconf() [RINI_SUPPORT_PARALLEL_LOAD, POSIX]
+*       - process.h: _beginthreadex() [RINI_SUPPORT_PARALLEL_LOAD, Windows]
+*       - sched.h: sched_yield() [RINI_SUPPORT_SNAPSHOTS, POSIX]
+*       - sys/mman.h, fcntl.h: mmap(), munmap(), open() [RINI_SUPPORT_BINARY, POSIX]
 *
 *   VERSIONS HISTORY:
 *       3.0 (xx-May-2026) ADDED: rini_data rini_load_full() to load comments and empty lines
+*                         ADDED: Keys hash index for constant-time values lookup
+*                         REDESIGNED: Single-pass loading, values point into loaded text buffer
+*                         REDESIGNED: Compact values, updated strings stored in a shared strings arena
+*                         REDESIGNED: Values capacity grows as required, RINI_MAX_VALUE_CAPACITY is optional
+*                         ADDED: Sections support, with section-scoped getters/setters and keys index
+*                         ADDED: rini_save_to_buffer(), reentrant saving to user buffer with required size
+*                         REDESIGNED: Saving formats lines manually into one buffer, written at once
+*                         ADDED: rini_save_atomic(), crash-safe saving via temporary file and rename
+*                         ADDED: rini_save_patch(), incremental saving of changed lines into source file
+*                         ADDED: Typed values (int, float, bool, string) resolved on loading/setting
+*                         ADDED: rini_get_value_type(), rini_try_get_value(), rini_try_get_value_bool()
+*                         ADDED: int64, uint64 and double values getters/setters, locale-independent parsing
+*                         ADDED: SIMD (SSE2/AVX2) structural chars scanning on loading
+*                         ADDED: rini_load_parallel(), multi-threaded loading of big files (optional)
+*                         ADDED: rini_parse_stream(), streaming parsing with a callback per line, constant memory
+*                         ADDED: rini_snapshot, immutable snapshots with atomic publishing and lock-free readers (optional)
+*                         ADDED: rini_reload(), file reloading only if changed, with added/removed/modified keys list
+*                         ADDED: rini_diff() and rini_merge(), data comparison and three-way merge
+*                         ADDED: rini_binary, compiled binary format loaded memory-mapped (optional)
+*                         ADDED: RINI_SCHEMA(), typed config struct and loader generated from fields list
+*                         ADDED: rini_arena, caller-owned memory arena for data loading and setters
+*                         ADDED: rini_stats and tracing callback, data statistics and phases timing (optional)
+*                         ADDED: rini_get_values(), batch getter for many keys with fallbacks
+*                         ADDED: rini_handle, keys resolved once for direct values access, with generation check
+*                         ADDED: rini_intern, keys interning table shared by many data, keys ids valid for all data
 *                         ADDED: Flag to consider a text entry as text
 *                         ADDED: Key and Value spacing defines
 *                         REDESIGNED: Improved comments support: empty lines, empty comments, comments
@@ -148,6 +241,14 @@
     #define RINIAPI       // Functions defined as 'extern' by default (implicit specifiers)
 #endif
 
+// NOTE: POSIX functions required by implementation must be enabled before including any system header
+#if defined(RINI_IMPLEMENTATION) && (RINI_USE_SAVE_FILE_SYNC || defined(RINI_SUPPORT_PARALLEL_LOAD) || defined(RINI_SUPPORT_SNAPSHOTS) || defined(RINI_SUPPORT_BINARY) || defined(RINI_SUPPORT_STATS)) && !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+    #define _POSIX_C_SOURCE 200112L     // Required for: fileno(), fsync(), sysconf(), sched_yield(), fstat(), mmap(), clock_gettime(), pthreads
+#endif
+
+#include <stdio.h>          // Required for: FILE
+#include <stddef.h>         // Required for: offsetof()
+
 //----------------------------------------------------------------------------------
 // Defines and Macros
 //----------------------------------------------------------------------------------
@@ -171,24 +272,13 @@
   #define RINI_LOG(...)
 #endif
 
-#if !defined(RINI_MAX_LINE_SIZE)
-    #define RINI_MAX_LINE_SIZE              512
-#endif
-
-#if !defined(RINI_MAX_KEY_SIZE)
-    #define RINI_MAX_KEY_SIZE                64
-#endif
-
-#if !defined(RINI_MAX_TEXT_SIZE)
-    #define RINI_MAX_TEXT_SIZE              256
-#endif
-
-#if !defined(RINI_MAX_DESC_SIZE)
-    #define RINI_MAX_DESC_SIZE              256
+#if !defined(RINI_INITIAL_VALUE_CAPACITY)
+    #define RINI_INITIAL_VALUE_CAPACITY      16
 #endif
 
+// Values capacity limit, 0 means no limit
 #if !defined(RINI_MAX_VALUE_CAPACITY)
-    #define RINI_MAX_VALUE_CAPACITY         256
+    #define RINI_MAX_VALUE_CAPACITY           0
 #endif
 
 #if !defined(RINI_MAX_TEXT_FILE_SIZE)
@@ -211,7 +301,7 @@
     #define RINI_LINE_COMMENT_DELIMITER     '#'
 #endif
 
-// Line section delimiter -NOT USED-
+// Line section delimiter (starting char)
 #if !defined(RINI_LINE_SECTION_DELIMITER)
     #define RINI_LINE_SECTION_DELIMITER     '['
 #endif
@@ -234,24 +324,294 @@
     #define RINI_DESCRIPTION_DELIMITER      '#'
 #endif
 
+// Use keys hash index for values lookup
+// NOTE: If disabled, values are looked-up with a linear scan
+#if !defined(RINI_USE_KEY_HASH_INDEX)
+    #define RINI_USE_KEY_HASH_INDEX          1
+#endif
+
+// Parallel loading support, rini_load_parallel() splits file in chunks parsed by multiple threads
+// NOTE: Requires threads library (pthreads, -pthread) on POSIX platforms
+//#define RINI_SUPPORT_PARALLEL_LOAD
+
+// Minimum chunk size for parallel loading, smaller files use less threads (or just one)
+#if !defined(RINI_PARALLEL_MIN_CHUNK_SIZE)
+    #define RINI_PARALLEL_MIN_CHUNK_SIZE     65536
+#endif
+
+// Snapshots support, read-only data shared between threads, published atomically and read without locks
+//#define RINI_SUPPORT_SNAPSHOTS
+
+// Compiled binary format support, data saved to a binary file loaded memory-mapped (no parsing)
+//#define RINI_SUPPORT_BINARY
+
+// Statistics support, data counters and phases timing, tracing callback for spans and lookups
+//#define RINI_SUPPORT_STATS
+
+// Use SIMD instructions (SSE2/AVX2) to scan text on loading, if supported by compiler target
+// NOTE: If disabled or not supported, text is scanned byte by byte
+#if !defined(RINI_USE_SIMD)
+    #define RINI_USE_SIMD                    1
+#endif
+
+// Flush saved file to disk before replacing original file, used by rini_save_atomic()
+// NOTE: Slower but data survives a system crash, not only a process crash
+#if !defined(RINI_USE_SAVE_FILE_SYNC)
+    #define RINI_USE_SAVE_FILE_SYNC          0
+#endif
+
+// Temporary file extension, appended to file name by rini_save_atomic()
+#if !defined(RINI_SAVE_TEMP_FILE_EXT)
+    #define RINI_SAVE_TEMP_FILE_EXT         ".tmp"
+#endif
+
+// Streaming parsing buffer size, stream is read in blocks of this size
+// NOTE: Buffer grows only for lines that do not fit in it
+#if !defined(RINI_STREAM_BUFFER_SIZE)
+    #define RINI_STREAM_BUFFER_SIZE        4096
+#endif
+
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
+// rini value type, resolved from value text when loaded or set
+typedef enum {
+    RINI_VALUE_NONE = 0,        // No value (key not found, comment or section line)
+    RINI_VALUE_STRING,          // Text value, not a number or boolean
+    RINI_VALUE_INT,             // Integer number value (64-bit)
+    RINI_VALUE_UINT,            // Unsigned integer number value (64-bit), only values bigger than signed max
+    RINI_VALUE_FLOAT,           // Decimal number value (double)
+    RINI_VALUE_BOOL             // Boolean value (true/false)
+} rini_value_type;
+
 // rini value entry
+// NOTE: Strings point into loaded text buffer or into strings arena (when updated by setters)
 typedef struct {
-    char key[RINI_MAX_KEY_SIZE];    // Value key identifier
-    char text[RINI_MAX_TEXT_SIZE];  // Value text
-    char desc[RINI_MAX_DESC_SIZE];  // Value description
-    bool is_text;                   // Value should be considered as text
+    const char *key;            // Value key identifier
+    const char *text;           // Value text
+    const char *desc;           // Value description
+    union {
+        long long int_value;    // Value as integer number (RINI_VALUE_INT)
+        unsigned long long uint_value; // Value as unsigned integer number (RINI_VALUE_UINT)
+        double float_value;     // Value as decimal number (RINI_VALUE_FLOAT)
+        bool bool_value;        // Value as boolean (RINI_VALUE_BOOL)
+    } typed;                    // Value typed representation, text is not parsed on every get
+    rini_value_type type;       // Value type
+    unsigned int key_len;       // Value key length
+    unsigned int text_len;      // Value text length
+    unsigned int desc_len;      // Value description length
+    unsigned int src_offset;    // Value line offset in source file
+    unsigned int src_size;      // Value line size in source file (line ending not included)
+    bool is_text;               // Value should be considered as text
+    bool is_section;            // Value is a section line, section name stored as text
+    bool in_source;             // Value line exists in source file (src_offset/src_size are valid)
+    bool is_dirty;              // Value has been updated since loaded/patched, line must be rewritten
 } rini_value;
 
+// rini keys hash index (open addressing, linear probing)
+typedef struct {
+    unsigned int *slots;        // Index slots, store value position + 1 (0 for empty slot)
+    unsigned int capacity;      // Index slots capacity (power-of-two)
+    unsigned int count;         // Index keys count
+} rini_index;
+
+// rini section
+// NOTE: Every section owns a contiguous range of values, starting with the section line
+typedef struct {
+    const char *name;           // Section name, empty for global section (values before any section line)
+    unsigned int first;         // Section first value position
+    unsigned int count;         // Section values count, including section line
+    rini_index index;           // Section keys hash index, positions relative to section first value
+} rini_section;
+
+// rini strings arena block
+// NOTE: Block data follows the header, blocks are chained and never moved
+typedef struct rini_string_block {
+    struct rini_string_block *next; // Next block in the chain
+    unsigned int size;          // Block data size
+    unsigned int used;          // Block data used
+} rini_string_block;
+
+// rini statistics, data operations counters and phases durations
+// NOTE: Only updated if RINI_SUPPORT_STATS defined, counters are not updated atomically (snapshots data has no statistics)
+typedef struct {
+    unsigned long long lookups; // Keys lookups by getters
+    unsigned long long hits;    // Keys lookups found
+    unsigned long long misses;  // Keys lookups not found (fallback/default value used)
+    unsigned long long sets;    // Existing values updated by setters
+    unsigned long long appends; // New values added by setters
+    unsigned long long truncations; // Lines/values dropped (capacity limit) or saved text truncated
+    unsigned long long bytes_read; // Text bytes read (file or memory)
+    unsigned long long bytes_written; // Text bytes written to files
+    double read_time;           // File read duration on loading (seconds)
+    double parse_time;          // Lines parsing duration on loading (seconds)
+    double index_time;          // Sections and keys indexes build duration on loading (seconds)
+    double save_time;           // Saving total duration (seconds)
+} rini_stats;
+
+// rini memory arena, caller-owned memory for data allocations (values, strings, indexes, text buffer)
+// NOTE: Data loaded with an arena is never freed individually, all memory is released at once by arena reset
+typedef struct {
+    rini_string_block *blocks;  // Arena blocks chain, current block first
+    unsigned int block_size;    // Arena blocks minimum size
+} rini_arena;
+
+// rini keys intern table, user-owned, keys ids shared by many data
+// NOTE: Zero-initialized is valid (empty table), keys ids are assigned in interning order and never change
+typedef struct {
+    const char **keys;          // Interned keys, by key id
+    unsigned int count;         // Interned keys count
+    unsigned int capacity;      // Interned keys capacity
+    unsigned int *slots;        // Keys hash slots (open addressing), store key id + 1 (0 for empty slot)
+    unsigned int slot_capacity; // Keys hash slots capacity (power-of-two)
+    rini_arena strings;         // Keys strings memory
+} rini_intern;
+
 // rini data
 typedef struct {
     rini_value *values;         // Values array
     unsigned int count;         // Values count
     unsigned int capacity;      // Values capacity
+    rini_index index;           // Values keys hash index
+    rini_section *sections;     // Sections array, first one is the global section
+    unsigned int section_count; // Sections count
+    unsigned int section_capacity; // Sections capacity
+    char *buffer;               // Loaded text buffer, values strings point into it
+    rini_string_block *strings; // Strings arena, strings copied by setters are stored there
+    unsigned int source_size;   // Source file size, used to verify file before patching it
+    unsigned long long source_hash; // Source file content hash, used to verify file before patching it
+    rini_arena *arena;          // Memory arena used for data allocations, NULL for heap allocations
+    rini_stats *stats;          // Data statistics, NULL if RINI_SUPPORT_STATS not defined
+    unsigned int generation;    // Values generation, increased when values are moved or removed (handles stale)
+    rini_intern *intern;        // Keys intern table, NULL if data keys not interned
+    unsigned int *key_positions; // Interned keys positions (by key id), value position + 1 (0 if not found)
+    unsigned int key_position_count; // Interned keys positions count (keys ids mapped)
+    unsigned int key_position_capacity; // Interned keys positions capacity
 } rini_data;
 
+#if defined(RINI_SUPPORT_SNAPSHOTS)
+// rini snapshot, read-only data shared between threads
+// NOTE: Snapshot is unloaded when last reference is released (publisher and readers references)
+typedef struct {
+    rini_data data;             // Snapshot data, read-only once created (only getters can be used)
+    volatile long refs;         // Snapshot references count
+} rini_snapshot;
+
+// rini shared, current snapshot published for readers threads
+// NOTE: Zero-initialized is valid (no snapshot published)
+typedef struct {
+    rini_snapshot *volatile current; // Current published snapshot
+    volatile long epoch;        // Readers epoch (0 or 1), flipped on every publish
+    volatile long readers[2];   // Readers acquiring a snapshot, per epoch
+    volatile long publishing;   // Publisher flag, publishers are serialized
+} rini_shared;
+#endif
+
+#if defined(RINI_SUPPORT_BINARY)
+// rini binary, compiled binary data (read-only)
+// NOTE: Data is a memory-mapped file or a user buffer, it is validated on loading
+typedef struct {
+    const unsigned char *data;  // Binary data, NULL if not valid
+    unsigned int size;          // Binary data size
+    bool mapped;                // Binary data is a memory-mapped file, unmapped on unloading
+} rini_binary;
+#endif
+
+// rini watch, file state to detect file changes on reloading
+// NOTE: Zero-initialized is valid, file is reloaded on first check
+typedef struct {
+    long long mtime;            // File modification time
+    long long size;             // File size
+    long long check_time;       // Last check time, file modified since then is hashed (same mtime/size not trusted)
+    unsigned long long hash;    // File content hash
+    bool valid;                 // File state is valid (file has been checked)
+} rini_watch;
+
+// rini change type
+typedef enum {
+    RINI_CHANGE_ADDED = 0,      // Key added
+    RINI_CHANGE_REMOVED,        // Key removed
+    RINI_CHANGE_MODIFIED,       // Key value text modified
+    RINI_CHANGE_DESCRIPTION     // Key description modified (value text not modified)
+} rini_change_type;
+
+// rini change, key changed on reloading, comparison or merge (conflicts)
+typedef struct {
+    rini_change_type type;      // Change type
+    const char *section;        // Key section name, empty for global section
+    const char *key;            // Key identifier
+} rini_change;
+
+// rini changes list
+// NOTE: Changes strings are copied, list is valid after data is unloaded
+typedef struct {
+    rini_change *changes;       // Changes array
+    unsigned int count;         // Changes count
+    char *strings;              // Changes strings (sections and keys)
+} rini_change_list;
+
+// rini stream event type, one event per parsed line
+typedef enum {
+    RINI_EVENT_VALUE = 0,       // Key-value line, value type resolved
+    RINI_EVENT_SECTION,         // Section line, section name as value text
+    RINI_EVENT_COMMENT,         // Comment line, comment as value description
+    RINI_EVENT_EMPTY            // Empty line
+} rini_event_type;
+
+// rini stream read callback, returns bytes read into buffer (0 on stream end, negative on error)
+typedef int (*rini_read_callback)(void *reader, char *buffer, unsigned int size);
+
+// rini stream event callback, returns non-zero to stop parsing
+// WARNING: Value strings are only valid during callback, they must be copied to be kept
+typedef int (*rini_event_callback)(rini_event_type type, const rini_value *value, void *user_data);
+
+// rini trace event type
+typedef enum {
+    RINI_TRACE_BEGIN = 0,       // Phase span begins, name: phase (read, parse, index, save)
+    RINI_TRACE_END,             // Phase span ends, name: phase, size: bytes (values count for index)
+    RINI_TRACE_HIT,             // Key lookup found, name: key
+    RINI_TRACE_MISS             // Key lookup not found, name: key
+} rini_trace_type;
+
+// rini trace callback, called on phases begin/end and keys lookups
+// WARNING: Name is only valid during callback, callback must be thread-safe if data is used by multiple threads
+typedef void (*rini_trace_callback)(rini_trace_type type, const char *name, unsigned long long size, void *user_data);
+
+// rini schema field type, struct field C type defined by RINI_SCHEMA_TYPE_*
+typedef enum {
+    RINI_FIELD_INT = 0,         // Field int, integer values only (in int range)
+    RINI_FIELD_BOOL,            // Field bool, boolean values (true/false) or integer 0/1
+    RINI_FIELD_INT64,           // Field long long, integer values only (in int64 range)
+    RINI_FIELD_UINT64,          // Field unsigned long long, non-negative integer values only
+    RINI_FIELD_DOUBLE,          // Field double, integer or decimal values
+    RINI_FIELD_TEXT             // Field const char *, value text (points into data)
+} rini_field_type;
+
+// rini schema field, generated by RINI_SCHEMA() for every struct field
+typedef struct {
+    const char *key;            // Field value key
+    unsigned int key_len;       // Field value key length
+    rini_field_type type;       // Field type
+    unsigned int offset;        // Field offset in struct
+} rini_field;
+
+// rini query, key resolved by batch getter rini_get_values()
+// NOTE: Value and fallback point to variables of query type C type (see RINI_SCHEMA_TYPE_*)
+typedef struct {
+    const char *key;            // Query key
+    rini_field_type type;       // Query value type
+    const void *fallback;       // Query fallback value, NULL to keep output value if not found or not valid
+    void *value;                // Query output value
+    bool found;                 // Query key found and value valid (output), fallback used if false
+} rini_query;
+
+// rini handle, key resolved once for direct value access (no key lookup)
+// NOTE: Handle is stale once data values are moved or removed (data generation changed)
+typedef struct {
+    int position;               // Value position, -1 if key not found
+    unsigned int generation;    // Data generation when key was resolved
+} rini_handle;
+
 #if defined(__cplusplus)
 extern "C" {                    // Prevents name mangling of functions
 #endif
@@ -262,10 +622,66 @@ extern "C" {                    // Prevents name mangling of functions
 RINIAPI rini_data rini_load(const char *file_name);         // Load data from file (*.ini) or create a new rini object (pass NULL)
 RINIAPI rini_data rini_load_full(const char *file_name);    // Load data from file (*.ini) including full comment lines, useful for editing
 RINIAPI rini_data rini_load_from_memory(const char *text);  // Load data from text buffer
+RINIAPI rini_data rini_load_arena(const char *file_name, rini_arena *arena); // Load data from file (*.ini) with all memory allocated from arena (NULL for heap)
+RINIAPI rini_data rini_load_from_memory_arena(const char *text, rini_arena *arena); // Load data from text buffer with all memory allocated from arena (NULL for heap)
+RINIAPI rini_arena rini_arena_create(unsigned int size); // Create memory arena, first block reserved (0 for default size)
+RINIAPI void rini_arena_reset(rini_arena *arena); // Reset memory arena, all data loaded with it released at once (memory kept for reuse)
+RINIAPI void rini_unload_arena(rini_arena *arena); // Unload memory arena, all blocks freed
+#if defined(RINI_SUPPORT_STATS)
+RINIAPI rini_stats rini_get_stats(rini_data data);          // Get data statistics (counters and phases durations)
+RINIAPI void rini_reset_stats(rini_data data);              // Reset data statistics
+RINIAPI void rini_set_trace_callback(rini_trace_callback callback, void *user_data); // Set tracing callback for all data (NULL to disable)
+#endif
+#if defined(RINI_SUPPORT_PARALLEL_LOAD)
+RINIAPI rini_data rini_load_parallel(const char *file_name, unsigned int thread_count); // Load data from file (*.ini) using multiple threads (0 for all cores), same result as rini_load()
+#endif
+RINIAPI int rini_parse_stream(rini_read_callback read_callback, void *reader, rini_event_callback callback, void *user_data); // Parse stream lines, callback per line, returns 0 on success, 1 if stopped by callback, -1 on error
+RINIAPI int rini_parse_file(FILE *file, rini_event_callback callback, void *user_data); // Parse opened file lines (streaming), callback per line
+RINIAPI int rini_parse_fd(int fd, rini_event_callback callback, void *user_data); // Parse file descriptor lines (streaming), callback per line
+RINIAPI int rini_reload(rini_data *data, const char *file_name, rini_watch *watch, rini_change_list *changes); // Reload data from file only if changed, returns 1 if reloaded, 0 if not changed, -1 on error
+RINIAPI void rini_unload_changes(rini_change_list *changes); // Unload changes list from memory
+RINIAPI int rini_diff(rini_data data, rini_data other, rini_change_list *changes); // Compare data keys with other data keys (added/removed/modified/description), returns changes count, -1 on error
+RINIAPI rini_data rini_merge(rini_data base, rini_data ours, rini_data theirs, rini_change_list *conflicts); // Three-way merge, theirs changes from base applied to ours (comments/order kept), ours wins conflicts
 RINIAPI void rini_save(rini_data data, const char *file_name); // Save data to file, with custom header
-RINIAPI char *rini_save_to_memory(rini_data data);          // Save data to text buffer ('\0' EOL)
+RINIAPI int rini_save_atomic(rini_data data, const char *file_name); // Save data to file atomically (temp file + rename), returns 0 on success
+RINIAPI int rini_save_patch(rini_data *data, const char *file_name); // Save only changed values into source file (incremental patch), returns 0 on success
+RINIAPI char *rini_save_to_memory(rini_data data);          // Save data to text buffer ('\0' EOL), static buffer returned
+RINIAPI unsigned int rini_save_to_buffer(rini_data data, char *buffer, unsigned int size); // Save data to provided buffer ('\0' EOL), returns required size (reentrant)
 RINIAPI void rini_unload(rini_data *data);                  // Unload data from memory
 
+#if defined(RINI_SUPPORT_SNAPSHOTS)
+RINIAPI rini_snapshot *rini_snapshot_create(rini_data data); // Create snapshot from data (data owned by snapshot), returns NULL on failure
+RINIAPI rini_snapshot *rini_snapshot_load(const char *file_name); // Load snapshot from file (*.ini), returns NULL if file can not be read (empty file is valid)
+RINIAPI void rini_snapshot_publish(rini_shared *shared, rini_snapshot *snapshot); // Publish snapshot (reference transferred), previous one released once no reader is acquiring it
+RINIAPI rini_snapshot *rini_snapshot_acquire(rini_shared *shared); // Acquire current snapshot (lock-free), returns NULL if no snapshot published
+RINIAPI void rini_snapshot_release(rini_snapshot *snapshot); // Release snapshot reference, unloaded if it was the last one
+#endif
+
+#if defined(RINI_SUPPORT_BINARY)
+RINIAPI int rini_save_binary(rini_data data, const char *file_name); // Save data to compiled binary file (atomically), returns 0 on success
+RINIAPI unsigned int rini_save_binary_to_buffer(rini_data data, void *buffer, unsigned int size); // Save data to compiled binary buffer (8-byte aligned), returns required size (written only if enough size)
+RINIAPI rini_binary rini_load_binary(const char *file_name); // Load compiled binary file (memory-mapped), data is NULL if not valid
+RINIAPI rini_binary rini_load_binary_from_memory(const void *buffer, unsigned int size); // Load compiled binary from buffer (not copied, 8-byte aligned), data is NULL if not valid
+RINIAPI void rini_unload_binary(rini_binary *binary); // Unload compiled binary (unmapped if memory-mapped)
+
+RINIAPI rini_value_type rini_binary_get_value_type(rini_binary binary, const char *key); // Get binary value type for provided key, RINI_VALUE_NONE if not found
+RINIAPI int rini_binary_get_value(rini_binary binary, const char *key); // Get binary value int for provided key, returns 0 if not found
+RINIAPI const char *rini_binary_get_value_text(rini_binary binary, const char *key); // Get binary value text for provided key, returns NULL if not found
+RINIAPI const char *rini_binary_get_value_description(rini_binary binary, const char *key); // Get binary value description for provided key, returns NULL if not found
+RINIAPI bool rini_binary_try_get_value_bool(rini_binary binary, const char *key, bool *value); // Get binary value bool for provided key, returns false if not found or not valid
+RINIAPI bool rini_binary_try_get_value_int64(rini_binary binary, const char *key, long long *value); // Get binary value int64 for provided key, returns false if not found or not valid
+RINIAPI bool rini_binary_try_get_value_uint64(rini_binary binary, const char *key, unsigned long long *value); // Get binary value uint64 for provided key, returns false if not found or not valid
+RINIAPI bool rini_binary_try_get_value_double(rini_binary binary, const char *key, double *value); // Get binary value double for provided key, returns false if not found or not valid
+
+RINIAPI rini_value_type rini_binary_get_section_value_type(rini_binary binary, const char *section, const char *key); // Get binary section value type for provided key, RINI_VALUE_NONE if not found
+RINIAPI int rini_binary_get_section_value(rini_binary binary, const char *section, const char *key); // Get binary section value int for provided key, returns 0 if not found
+RINIAPI const char *rini_binary_get_section_value_text(rini_binary binary, const char *section, const char *key); // Get binary section value text for provided key, returns NULL if not found
+RINIAPI bool rini_binary_try_get_section_value_bool(rini_binary binary, const char *section, const char *key, bool *value); // Get binary section value bool for provided key, returns false if not found or not valid
+RINIAPI bool rini_binary_try_get_section_value_int64(rini_binary binary, const char *section, const char *key, long long *value); // Get binary section value int64 for provided key, returns false if not found or not valid
+RINIAPI bool rini_binary_try_get_section_value_uint64(rini_binary binary, const char *section, const char *key, unsigned long long *value); // Get binary section value uint64 for provided key, returns false if not found or not valid
+RINIAPI bool rini_binary_try_get_section_value_double(rini_binary binary, const char *section, const char *key, double *value); // Get binary section value double for provided key, returns false if not found or not valid
+#endif
+
 RINIAPI int rini_get_value(rini_data data, const char *key); // Get value int for provided key, returns 0 if not found
 RINIAPI const char *rini_get_value_text(rini_data data, const char *key); // Get value text for provided key
 RINIAPI const char *rini_get_value_description(rini_data data, const char *key); // Get value description for provided key
@@ -273,21 +689,138 @@ RINIAPI const char *rini_get_value_description(rini_data data, const char *key);
 RINIAPI int rini_get_value_fallback(rini_data data, const char *key, int fallback); // Get value for provided key with default value fallback if not found or not valid
 RINIAPI const char *rini_get_value_text_fallback(rini_data data, const char *key, const char *fallback); // Get value text for provided key with fallback if not found or not valid
 
+// Get value typed, converted from typed representation resolved on loading/setting
+// NOTE: Returns false if key not found or value type can not be converted, provided value is not modified
+RINIAPI rini_value_type rini_get_value_type(rini_data data, const char *key); // Get value type for provided key, RINI_VALUE_NONE if not found
+RINIAPI bool rini_try_get_value(rini_data data, const char *key, int *value); // Get value int for provided key, integer values only (in int range)
+RINIAPI bool rini_try_get_value_bool(rini_data data, const char *key, bool *value); // Get value bool for provided key, boolean values (true/false) or integer 0/1
+RINIAPI bool rini_try_get_value_int64(rini_data data, const char *key, long long *value); // Get value int64 for provided key, integer values only (in int64 range)
+RINIAPI bool rini_try_get_value_uint64(rini_data data, const char *key, unsigned long long *value); // Get value uint64 for provided key, non-negative integer values only
+RINIAPI bool rini_try_get_value_double(rini_data data, const char *key, double *value); // Get value double for provided key, integer or decimal values
+
+RINIAPI long long rini_get_value_int64(rini_data data, const char *key); // Get value int64 for provided key, returns 0 if not found or not valid
+RINIAPI unsigned long long rini_get_value_uint64(rini_data data, const char *key); // Get value uint64 for provided key, returns 0 if not found or not valid
+RINIAPI double rini_get_value_double(rini_data data, const char *key); // Get value double for provided key, returns 0.0 if not found or not valid
+
 RINIAPI int rini_set_comment_line(rini_data *data, const char *comment); // Set comment line
 
 // Set value int/text and description for existing key or create a new entry
 // NOTE: When setting a text value, if id does not exist, a new entry is automatically created
 RINIAPI int rini_set_value(rini_data *data, const char *key, int value, const char *desc);
 RINIAPI int rini_set_value_text(rini_data *data, const char *key, const char *text, const char *desc);
+RINIAPI int rini_set_value_int64(rini_data *data, const char *key, long long value, const char *desc);
+RINIAPI int rini_set_value_uint64(rini_data *data, const char *key, unsigned long long value, const char *desc);
+RINIAPI int rini_set_value_double(rini_data *data, const char *key, double value, const char *desc); // NOTE: Saved with shortest text that reads back the same value
 
 // Set value description for existing key
 // WARNING: Key must exist to add description, if a description exists, it is updated
 RINIAPI int rini_set_value_description(rini_data *data, const char *key, const char *desc);
 
+// Section values access, only values owned by provided section are considered
+// NOTE: Section NULL or empty refers to global section, values before any section line
+RINIAPI int rini_get_section_value(rini_data data, const char *section, const char *key); // Get section value int for provided key, returns 0 if not found
+RINIAPI const char *rini_get_section_value_text(rini_data data, const char *section, const char *key); // Get section value text for provided key
+RINIAPI const char *rini_get_section_value_description(rini_data data, const char *section, const char *key); // Get section value description for provided key
+RINIAPI int rini_get_section_value_fallback(rini_data data, const char *section, const char *key, int fallback); // Get section value for provided key with default value fallback
+RINIAPI const char *rini_get_section_value_text_fallback(rini_data data, const char *section, const char *key, const char *fallback); // Get section value text for provided key with fallback
+RINIAPI rini_value_type rini_get_section_value_type(rini_data data, const char *section, const char *key); // Get section value type for provided key, RINI_VALUE_NONE if not found
+RINIAPI bool rini_try_get_section_value(rini_data data, const char *section, const char *key, int *value); // Get section value int for provided key, returns false if not found or not valid
+RINIAPI bool rini_try_get_section_value_bool(rini_data data, const char *section, const char *key, bool *value); // Get section value bool for provided key, returns false if not found or not valid
+RINIAPI bool rini_try_get_section_value_int64(rini_data data, const char *section, const char *key, long long *value); // Get section value int64 for provided key, returns false if not found or not valid
+RINIAPI bool rini_try_get_section_value_uint64(rini_data data, const char *section, const char *key, unsigned long long *value); // Get section value uint64 for provided key, returns false if not found or not valid
+RINIAPI bool rini_try_get_section_value_double(rini_data data, const char *section, const char *key, double *value); // Get section value double for provided key, returns false if not found or not valid
+
+// Set section value int/text and description for existing key or create a new entry
+// NOTE: If section does not exist, a new section is automatically created at the end
+RINIAPI int rini_set_section_value(rini_data *data, const char *section, const char *key, int value, const char *desc);
+RINIAPI int rini_set_section_value_text(rini_data *data, const char *section, const char *key, const char *text, const char *desc);
+RINIAPI int rini_set_section_value_int64(rini_data *data, const char *section, const char *key, long long value, const char *desc);
+RINIAPI int rini_set_section_value_uint64(rini_data *data, const char *section, const char *key, unsigned long long value, const char *desc);
+RINIAPI int rini_set_section_value_double(rini_data *data, const char *section, const char *key, double value, const char *desc);
+RINIAPI int rini_set_section_value_description(rini_data *data, const char *section, const char *key, const char *desc);
+
+// Get section values (iterator), returns pointer to first value after section line and values count
+// NOTE: Returned values include comments and empty lines (if loaded), NULL returned if section not found
+RINIAPI rini_value *rini_get_section_values(rini_data data, const char *section, unsigned int *count);
+
+// Load schema fields into config struct (one key lookup per field), fields not found or not valid are not modified
+// NOTE: Usually called by RINI_SCHEMA() generated loader, returns fields found count (found with a valid value)
+// WARNING: Misspelled or missing keys are not reported, field silently keeps default, check returned count if required
+RINIAPI int rini_load_schema(rini_data data, const rini_field *fields, unsigned int field_count, void *config);
+
+// Get values for many keys at once (batch), every query output is filled with value or fallback
+// NOTE: Keys are resolved with one index probe each (single pass over values if not indexed), returns fallbacks count
+RINIAPI int rini_get_values(rini_data data, rini_query *queries, unsigned int count);
+
+// Get handle for provided key, resolved once for direct value access (no key lookup), position -1 if not found
+// NOTE: Handle is stale once values are moved (value inserted before it), removed or data reloaded/unloaded
+RINIAPI rini_handle rini_get_handle(rini_data data, const char *key); // Get handle for provided key
+RINIAPI rini_handle rini_get_section_handle(rini_data data, const char *section, const char *key); // Get handle for provided key in section
+RINIAPI bool rini_handle_is_valid(rini_data data, rini_handle handle); // Check handle is valid (key found, not stale)
+RINIAPI rini_value_type rini_handle_get_value_type(rini_data data, rini_handle handle); // Get handle value type, RINI_VALUE_NONE if not valid
+RINIAPI int rini_handle_get_value(rini_data data, rini_handle handle); // Get handle value, returns 0 if not valid
+RINIAPI const char *rini_handle_get_value_text(rini_data data, rini_handle handle); // Get handle value text, returns NULL if not valid
+RINIAPI bool rini_handle_try_get_value_bool(rini_data data, rini_handle handle, bool *value); // Get handle value bool, returns false if not valid
+RINIAPI bool rini_handle_try_get_value_int64(rini_data data, rini_handle handle, long long *value); // Get handle value int64, returns false if not valid
+RINIAPI bool rini_handle_try_get_value_uint64(rini_data data, rini_handle handle, unsigned long long *value); // Get handle value uint64, returns false if not valid
+RINIAPI bool rini_handle_try_get_value_double(rini_data data, rini_handle handle, double *value); // Get handle value double, returns false if not valid
+RINIAPI int rini_handle_set_value(rini_data *data, rini_handle handle, int value, const char *desc); // Set handle value and description, returns -1 if not valid
+RINIAPI int rini_handle_set_value_int64(rini_data *data, rini_handle handle, long long value, const char *desc); // Set handle value int64 and description, returns -1 if not valid
+RINIAPI int rini_handle_set_value_uint64(rini_data *data, rini_handle handle, unsigned long long value, const char *desc); // Set handle value uint64 and description, returns -1 if not valid
+RINIAPI int rini_handle_set_value_double(rini_data *data, rini_handle handle, double value, const char *desc); // Set handle value double and description, returns -1 if not valid
+RINIAPI int rini_handle_set_value_text(rini_data *data, rini_handle handle, const char *text, const char *desc); // Set handle value text and description, returns -1 if not valid
+
+// Keys interning, keys of many data identified by key id (user-owned table), key id valid for any data
+// NOTE: Interning does not reduce data memory (loaded text buffer is kept), it provides keys ids and pointer compares
+// WARNING: Intern table must be unloaded after all data using it, it is not thread-safe when adding keys
+RINIAPI int rini_intern_key(rini_intern *intern, const char *key); // Intern key (added if not found), returns key id or -1 on failure
+RINIAPI int rini_intern_find(rini_intern intern, const char *key); // Find interned key id, returns -1 if not interned
+RINIAPI const char *rini_intern_get_key(rini_intern intern, int key_id); // Get interned key for key id, returns NULL if not valid
+RINIAPI void rini_unload_intern(rini_intern *intern); // Unload intern table, all keys freed
+RINIAPI int rini_intern_data(rini_data *data, rini_intern *intern); // Intern data keys (keys positions mapped by key id), returns 0 on success
+RINIAPI rini_handle rini_get_interned_handle(rini_data data, int key_id); // Get handle for interned key id (no key lookup), position -1 if not found
+
 #ifdef __cplusplus
 }
 #endif
 
+//----------------------------------------------------------------------------------
+// Schema Macros
+//----------------------------------------------------------------------------------
+// Compile-time schema, config struct and typed loader generated from a fields list (X-macro)
+// NOTE: Fields are declared once as X(TYPE, name, key, default), key must be a string literal,
+// config values become plain struct fields (no keys lookup) and field names are checked by compiler
+// Usage:
+//
+//     #define GAME_CONFIG(X) X(INT, screen_width, "screen_width", 800) X(TEXT, title, "title", "rini example")
+//
+//     RINI_SCHEMA(game_config, GAME_CONFIG)   // Generates: game_config struct, game_config_load(rini_data)
+//
+//     game_config config = game_config_load(data);    // Fields not found keep default values (not reported)
+//
+// WARNING: TEXT fields point into data strings (or default literal), data must be kept loaded while used
+#define RINI_SCHEMA_TYPE_INT        int
+#define RINI_SCHEMA_TYPE_BOOL       bool
+#define RINI_SCHEMA_TYPE_INT64      long long
+#define RINI_SCHEMA_TYPE_UINT64     unsigned long long
+#define RINI_SCHEMA_TYPE_DOUBLE     double
+#define RINI_SCHEMA_TYPE_TEXT       const char *
+
+#define RINI_SCHEMA_MEMBER(type, name, key, value)  RINI_SCHEMA_TYPE_##type name;
+#define RINI_SCHEMA_DEFAULT(type, name, key, value) value,
+#define RINI_SCHEMA_FIELD(type, name, key, value)   { key, sizeof(key) - 1, RINI_FIELD_##type, (unsigned int)offsetof(rini_schema_struct, name) },
+
+#define RINI_SCHEMA(schema, FIELDS) \
+    typedef struct { FIELDS(RINI_SCHEMA_MEMBER) } schema; \
+    static inline schema schema##_load(rini_data data) \
+    { \
+        typedef schema rini_schema_struct; \
+        static const rini_field fields[] = { FIELDS(RINI_SCHEMA_FIELD) }; \
+        schema config = { FIELDS(RINI_SCHEMA_DEFAULT) }; \
+        rini_load_schema(data, fields, sizeof(fields)/sizeof(fields[0]), &config); \
+        return config; \
+    }
+
 #endif // RINI_H
 
 /***********************************************************************************
@@ -298,27 +831,314 @@ RINIAPI int rini_set_value_description(rini_data *data, const char *key, const c
 
 #if defined(RINI_IMPLEMENTATION)
 
-#include <stdio.h>          // Required for: fopen(), feof(), fgets(), fclose(), fprintf()
-#include <stdlib.h>         // Required for: malloc(), calloc(), free()
-#include <string.h>         // Required for: memset(), memcpy(), strcmp(), strlen()
+#include <stdio.h>          // Required for: fopen(), fseek(), ftell(), fread(), fwrite(), fflush(), fclose(), rename(), remove(), snprintf()
+#include <stdlib.h>         // Required for: malloc(), calloc(), free(), strtod()
+#include <string.h>         // Required for: memset(), memcpy(), memchr(), strcmp(), strrchr(), strlen()
+#include <time.h>           // Required for: time(), clock_gettime()
+#include <sys/stat.h>       // Required for: stat()
+
+// SIMD instructions set used to scan text, detected from compiler target
+#if RINI_USE_SIMD
+    #if defined(__AVX2__)
+        #include <immintrin.h>  // Required for: AVX2 intrinsics
+        #define RINI_SIMD_BLOCK_SIZE    32
+    #elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+        #include <emmintrin.h>  // Required for: SSE2 intrinsics
+        #define RINI_SIMD_BLOCK_SIZE    16
+    #endif
+    #if defined(RINI_SIMD_BLOCK_SIZE) && defined(_MSC_VER)
+        #include <intrin.h>     // Required for: _BitScanForward()
+    #endif
+#endif
+
+#if defined(_WIN32)
+    #include <io.h>         // Required for: _read(), _commit(), _fileno()
+#else
+    #include <unistd.h>     // Required for: read(), fsync(), close()
+    #if RINI_USE_SAVE_FILE_SYNC || defined(RINI_SUPPORT_BINARY)
+        #include <fcntl.h>  // Required for: open()
+    #endif
+    #if defined(RINI_SUPPORT_BINARY)
+        #include <sys/mman.h>   // Required for: mmap(), munmap()
+    #endif
+#endif
+
+#if defined(RINI_SUPPORT_PARALLEL_LOAD)
+    #if defined(_WIN32)
+        #include <process.h>    // Required for: _beginthreadex()
+    #else
+        #include <pthread.h>    // Required for: pthread_create(), pthread_join()
+        #include <unistd.h>     // Required for: sysconf()
+    #endif
+#endif
+
+#if defined(RINI_SUPPORT_SNAPSHOTS)
+    #if defined(_MSC_VER)
+        #include <intrin.h>     // Required for: _InterlockedExchangeAdd(), _InterlockedExchange(), _InterlockedExchangePointer()
+    #elif !defined(_WIN32)
+        #include <sched.h>      // Required for: sched_yield()
+    #endif
+#endif
+
+#if defined(_WIN32)
+// NOTE: Avoid including windows.h, only required functions are declared
+// rename() fails on Windows if destination file exists, MoveFileExA() can replace it
+#if defined(__cplusplus)
+extern "C" {
+#endif
+__declspec(dllimport) int __stdcall MoveFileExA(const char *lpExistingFileName, const char *lpNewFileName, unsigned long dwFlags);
+#if defined(RINI_SUPPORT_PARALLEL_LOAD) || defined(RINI_SUPPORT_BINARY)
+__declspec(dllimport) int __stdcall CloseHandle(void *hObject);
+#endif
+#if defined(RINI_SUPPORT_PARALLEL_LOAD)
+__declspec(dllimport) unsigned long __stdcall WaitForSingleObject(void *hHandle, unsigned long dwMilliseconds);
+__declspec(dllimport) unsigned long __stdcall GetActiveProcessorCount(unsigned short GroupNumber);
+#endif
+#if defined(RINI_SUPPORT_STATS)
+__declspec(dllimport) int __stdcall QueryPerformanceCounter(long long *lpPerformanceCount);
+__declspec(dllimport) int __stdcall QueryPerformanceFrequency(long long *lpFrequency);
+#endif
+#if defined(RINI_SUPPORT_BINARY)
+__declspec(dllimport) void *__stdcall CreateFileA(const char *lpFileName, unsigned long dwDesiredAccess, unsigned long dwShareMode, void *lpSecurityAttributes, unsigned long dwCreationDisposition, unsigned long dwFlagsAndAttributes, void *hTemplateFile);
+__declspec(dllimport) unsigned long __stdcall GetFileSize(void *hFile, unsigned long *lpFileSizeHigh);
+__declspec(dllimport) void *__stdcall CreateFileMappingA(void *hFile, void *lpFileMappingAttributes, unsigned long flProtect, unsigned long dwMaximumSizeHigh, unsigned long dwMaximumSizeLow, const char *lpName);
+__declspec(dllimport) void *__stdcall MapViewOfFile(void *hFileMappingObject, unsigned long dwDesiredAccess, unsigned long dwFileOffsetHigh, unsigned long dwFileOffsetLow, size_t dwNumberOfBytesToMap);
+__declspec(dllimport) int __stdcall UnmapViewOfFile(const void *lpBaseAddress);
+#endif
+#if defined(RINI_SUPPORT_SNAPSHOTS)
+__declspec(dllimport) int __stdcall SwitchToThread(void);
+#endif
+#if defined(__cplusplus)
+}
+#endif
+#define RINI_MOVEFILE_REPLACE_EXISTING  0x00000001
+#define RINI_MOVEFILE_WRITE_THROUGH     0x00000008
+#endif
 
 //----------------------------------------------------------------------------------
 // Defines and macros
 //----------------------------------------------------------------------------------
-// ...
+// Strings arena blocks size, blocks grow geometrically from min to max size
+// NOTE: Strings bigger than max block size get their own block
+#define RINI_STRING_BLOCK_MIN_SIZE      256
+#define RINI_STRING_BLOCK_MAX_SIZE    65536
+
+// Statistics counter update, compiled out if statistics not supported
+#if defined(RINI_SUPPORT_STATS)
+    #define RINI_STATS_ADD(stats, counter, count)  do { if ((stats) != NULL) (stats)->counter += (count); } while (0)
+#else
+    #define RINI_STATS_ADD(stats, counter, count)  do { } while (0)
+#endif
+
+// Memory arena default block size, blocks are added on demand (at least allocation size)
+#define RINI_ARENA_BLOCK_SIZE         65536
+
+// Text padding required after loaded text, blocks scanning can read past text end
+#define RINI_SCAN_PADDING                32
+
+// Maximum threads used for parallel loading
+#define RINI_PARALLEL_MAX_THREADS       256
+
+// Compiled binary format identifier and version, version must be increased on any layout change
+#define RINI_BINARY_MAGIC            "RINB"
+#define RINI_BINARY_VERSION               1
+#define RINI_BINARY_ENDIANNESS   0x01020304     // Written in native byte order, binary is not valid on other byte order
+
+#if defined(RINI_SUPPORT_SNAPSHOTS)
+// Atomic operations used by snapshots, sequentially consistent
+// NOTE: RINI_ATOMIC_ADD() returns previous value
+#if defined(_MSC_VER)
+    #define RINI_ATOMIC_LOAD(ptr)               _InterlockedExchangeAdd((volatile long *)(ptr), 0)
+    #define RINI_ATOMIC_ADD(ptr, value)         _InterlockedExchangeAdd((volatile long *)(ptr), (value))
+    #define RINI_ATOMIC_EXCHANGE(ptr, value)    _InterlockedExchange((volatile long *)(ptr), (value))
+    #define RINI_ATOMIC_LOAD_PTR(ptr)           _InterlockedCompareExchangePointer((void *volatile *)(ptr), NULL, NULL)
+    #define RINI_ATOMIC_EXCHANGE_PTR(ptr, value) _InterlockedExchangePointer((void *volatile *)(ptr), (value))
+    #define RINI_YIELD()                        SwitchToThread()
+#else
+    #define RINI_ATOMIC_LOAD(ptr)               __atomic_load_n((ptr), __ATOMIC_SEQ_CST)
+    #define RINI_ATOMIC_ADD(ptr, value)         __atomic_fetch_add((ptr), (value), __ATOMIC_SEQ_CST)
+    #define RINI_ATOMIC_EXCHANGE(ptr, value)    __atomic_exchange_n((ptr), (value), __ATOMIC_SEQ_CST)
+    #define RINI_ATOMIC_LOAD_PTR(ptr)           __atomic_load_n((ptr), __ATOMIC_SEQ_CST)
+    #define RINI_ATOMIC_EXCHANGE_PTR(ptr, value) __atomic_exchange_n((ptr), (value), __ATOMIC_SEQ_CST)
+    #if defined(_WIN32)
+        #define RINI_YIELD()                    SwitchToThread()
+    #else
+        #define RINI_YIELD()                    sched_yield()
+    #endif
+#endif
+#endif
+
+// Platform byte order, digits are read 8 at once on little-endian platforms
+#if defined(__BYTE_ORDER__) && defined(__ORDER_BIG_ENDIAN__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+    #define RINI_LITTLE_ENDIAN              0
+#else
+    #define RINI_LITTLE_ENDIAN              1
+#endif
+
+#if defined(RINI_SUPPORT_BINARY)
+// rini binary header
+// NOTE: Binary layout: [header][values][sections][keys slots][section keys slots][strings pool],
+// all offsets are relative to binary start, blocks are 8-byte aligned
+typedef struct {
+    char magic[4];              // Binary format identifier: RINI_BINARY_MAGIC
+    unsigned int version;       // Binary format version: RINI_BINARY_VERSION
+    unsigned int endianness;    // Byte order check: RINI_BINARY_ENDIANNESS
+    unsigned int size;          // Binary total size
+    unsigned long long checksum; // Binary data checksum (after header)
+    unsigned int value_count;   // Values count
+    unsigned int section_count; // Sections count, first one is the global section
+    unsigned int slot_count;    // Keys hash tables slots count (power-of-two), same for both tables
+    unsigned int strings_size;  // Strings pool size
+    unsigned int values_offset; // Values offset
+    unsigned int sections_offset; // Sections offset
+    unsigned int keys_offset;   // Keys hash table offset (first key in file order, same as rini_get_value())
+    unsigned int section_keys_offset; // Section keys hash table offset (key and section)
+    unsigned int strings_offset; // Strings pool offset, all strings '\0' ended
+    unsigned int reserved;      // Reserved, header size kept 8-byte aligned
+} rini_binary_header;
+
+// rini binary value
+typedef struct {
+    unsigned long long typed;   // Value typed representation bits (int64/uint64/double/bool)
+    unsigned int key;           // Value key offset in strings pool
+    unsigned int key_len;       // Value key length
+    unsigned int text;          // Value text offset in strings pool
+    unsigned int text_len;      // Value text length
+    unsigned int desc;          // Value description offset in strings pool
+    unsigned int desc_len;      // Value description length
+    unsigned int section;       // Value section index
+    unsigned int hash;          // Value key hash
+    unsigned int type;          // Value type (rini_value_type)
+    unsigned int is_text;       // Value should be considered as text
+} rini_binary_value;
+
+// rini binary section
+typedef struct {
+    unsigned int name;          // Section name offset in strings pool
+    unsigned int name_len;      // Section name length
+} rini_binary_section;
+#endif
+
+#if defined(RINI_SUPPORT_PARALLEL_LOAD)
+// rini chunk, lines range to be parsed by a thread on parallel loading
+typedef struct {
+    rini_data data;             // Chunk values (only values, no sections or indexes)
+    char *start;                // Chunk lines start
+    char *end;                  // Chunk lines end, parsed by thread (lines after it are parsed on merging)
+    char *chunk_end;            // Chunk end (next chunk start)
+    bool result;                // Chunk parsing result
+} rini_chunk;
+#endif
 
 //----------------------------------------------------------------------------------
 // Global variables definition
 //----------------------------------------------------------------------------------
-// ...
+#if defined(RINI_SUPPORT_STATS)
+static rini_trace_callback rini_trace = NULL;   // Tracing callback, shared by all data
+static void *rini_trace_user_data = NULL;       // Tracing callback user data
+#endif
 
 //----------------------------------------------------------------------------------
 // Module Internal Functions Declaration
 //----------------------------------------------------------------------------------
-static int rini_read_key(const char *buffer, char *key); // Get key from a buffer line containing key-value-(description)
-static int rini_read_value_text(const char *buffer, char *text, char *desc, bool *is_text); // Get value text (and description) from a buffer line
+static char *rini_load_file_text(const char *file_name, unsigned int *size, rini_arena *arena); // Load text file into a buffer ('\0' ended), file is read at once
+static int rini_save_file_text(const char *file_name, const char *text, unsigned int size, bool sync, bool binary); // Save text buffer into file at once, returns 0 on success
+static int rini_replace_file(const char *file_name, const char *new_file_name); // Replace file with new file (atomic rename), returns 0 on success
+static int rini_save_file_atomic(const char *file_name, const char *text, unsigned int size); // Save text buffer into temporary file replacing file once written, returns 0 on success
+static int rini_save_source(rini_data *data, const char *file_name); // Save data to file as new source file (lines spans updated), returns 0 on success
+static unsigned int rini_patch_text(rini_data *data, unsigned int first, const char *src, unsigned int start, char *buffer, unsigned int size); // Write patched source text from first changed value, returns text length
+static rini_data rini_load_buffer(char *buffer, unsigned int size, bool full, rini_arena *arena); // Load data from text buffer, buffer ownership is moved to returned data
+static bool rini_read_lines(rini_data *data, char *line, char *end, bool full); // Read lines into data values (appended), returns false if values capacity can not be increased
+static void rini_load_sections(rini_data *data); // Load sections and keys indexes for data values
+#if defined(RINI_SUPPORT_PARALLEL_LOAD)
+static unsigned int rini_get_cpu_count(void); // Get available CPU cores count
+#if defined(_WIN32)
+static unsigned __stdcall rini_read_chunk(void *chunk); // Read chunk lines into chunk values (thread function)
+#else
+static void *rini_read_chunk(void *chunk); // Read chunk lines into chunk values (thread function)
+#endif
+#endif
+static bool rini_read_line(char *line, char *end, rini_value *value, bool full); // Read value from a text line, tokenized in-place
+static int rini_read_event(char *line, char *end, rini_event_callback callback, void *user_data); // Read line and send it to event callback, returns callback result
+static int rini_read_file_stream(void *reader, char *buffer, unsigned int size); // Read callback for FILE* streams
+static int rini_read_fd_stream(void *reader, char *buffer, unsigned int size); // Read callback for file descriptors
+static int rini_diff_keys(rini_data data, rini_data other, bool descriptions, rini_change_list *changes); // Compare data keys with other data keys into changes list, returns changes count, -1 on error
+static void rini_compare_keys(rini_data data, rini_data other, rini_change_type type, bool descriptions, rini_change_list *changes, unsigned int *strings_size); // Compare data keys with other data keys, changes added to changes list
+static void rini_add_change(rini_change_list *changes, rini_change_type type, const char *section, const char *key, unsigned int *strings_size); // Add change to changes list (or measure it if list not allocated)
+static unsigned int rini_merge_text(rini_data base, rini_data ours, rini_data theirs, char *buffer, unsigned int size, rini_change_list *conflicts, unsigned int *strings_size); // Write merged text into buffer, returns text length
+static unsigned int rini_merge_added(rini_data base, int base_section, rini_data ours, int ours_section, rini_data theirs, int theirs_section, char *buffer, unsigned int size, unsigned int offset, rini_change_list *conflicts, unsigned int *strings_size); // Write theirs section keys not found in ours section, returns text length
+static unsigned long long rini_hash_text(const char *text, unsigned int size); // Compute text hash (64bit), used to detect file content changes
+#if defined(RINI_SUPPORT_STATS)
+static double rini_get_time(void); // Get current time in seconds (monotonic, high resolution)
+static double rini_trace_begin(const char *name); // Begin phase span (trace callback), returns span start time
+static double rini_trace_end(const char *name, unsigned long long size, double start_time); // End phase span (trace callback), returns span duration
+#endif
+#if defined(RINI_SUPPORT_BINARY)
+static bool rini_binary_check(const unsigned char *data, unsigned int size); // Check binary data is valid (header, layout, checksum and strings)
+static unsigned int rini_binary_probe(const unsigned int *slots, unsigned int mask, const rini_binary_value *values, const char *strings, unsigned int hash, int section, const char *key, unsigned int key_len); // Probe keys hash table for key (section -1 for any section), returns key slot or empty slot
+static bool rini_binary_find(rini_binary binary, bool in_section, const char *section, const char *key, rini_value *value); // Find binary value for key (in section if requested), returns false if not found
+static const unsigned char *rini_map_file(const char *file_name, unsigned int *size); // Map file into memory (read-only), returns NULL on failure
+static void rini_unmap_file(const unsigned char *data, unsigned int size); // Unmap file from memory
+#endif
+static char *rini_find_chars(char *ptr, char *end, char c0, char c1, char c2); // Find first char matching any of provided chars, returns end if not found
+#if defined(RINI_SIMD_BLOCK_SIZE)
+static unsigned int rini_count_trailing_zeros(unsigned int mask); // Count mask trailing zero bits, mask must not be 0
+#endif
+static void rini_set_string(rini_data *data, const char **str, unsigned int *len, const char *text); // Set value string (key, text or description), string is copied
+static char *rini_alloc_string(rini_data *data, unsigned int size); // Allocate string memory from strings arena
+static void *rini_alloc(rini_arena *arena, unsigned int size); // Allocate memory from arena (8-byte aligned) or heap (NULL arena)
+static void rini_free(rini_arena *arena, void *ptr); // Free memory allocated with rini_alloc(), arena memory is only released on arena reset
+static rini_string_block *rini_arena_add_block(rini_arena *arena, unsigned int size); // Add new block to arena (current block), returns NULL on failure
+static bool rini_grow_values(rini_data *data); // Grow values capacity (geometrically), returns false if not possible
+static unsigned int rini_write_value(const rini_value *value, char *buffer, unsigned int size, unsigned int offset); // Write value line into buffer at offset, returns line length
+static unsigned int rini_write_line(const rini_value *value, char *line); // Write value line with no bounds checks (room for rini_line_bound() chars required), returns line length
+static unsigned int rini_line_bound(const rini_value *value); // Get value line length upper bound, formatted line is never longer
+static char *rini_save_text(rini_data data, unsigned int *size); // Save data into new allocated text ('\0' ended), single pass, returns NULL on failure
+static unsigned int rini_write_text(char *buffer, unsigned int size, unsigned int offset, const char *text, unsigned int len); // Write text into buffer at offset, returns text length
+static unsigned int rini_write_chars(char *buffer, unsigned int size, unsigned int offset, char c, unsigned int count); // Write repeated char into buffer at offset, returns chars count
+static unsigned int rini_int_to_text(long long value, char *text); // Convert int value to text, returns text length
+static unsigned int rini_uint_to_text(unsigned long long value, char *text); // Convert unsigned int value to text, returns text length
+static unsigned int rini_double_to_text(double value, char *text); // Convert double value to text (shortest round-trip, locale-independent), returns text length
 
 static int rini_text_to_int(const char *text); // Convert text to int value (if possible), same as atoi()
+static void rini_resolve_value(rini_value *value); // Resolve value type and typed representation from value text
+static unsigned int rini_read_digits(const char *text, unsigned int len, unsigned int i, bool decimal, unsigned long long *mantissa, unsigned int *significant, int *exponent, bool *exact); // Read number digits into mantissa, returns position after digits
+static bool rini_read_eight_digits(const char *text, unsigned int *value); // Read 8 digits at once (SWAR), returns false if any char is not a digit
+static double rini_text_to_double(const char *text, unsigned int len); // Convert text to double with strtod(), independent of locale decimal point
+static int rini_value_to_int(const rini_value *value); // Get value as int from typed representation, text values converted as atoi()
+static bool rini_value_try_int(const rini_value *value, int *result); // Get value as int, only integer values (in int range) are valid
+static bool rini_value_try_bool(const rini_value *value, bool *result); // Get value as bool, only boolean values or integer 0/1 are valid
+static bool rini_value_try_int64(const rini_value *value, long long *result); // Get value as int64, only integer values (in int64 range) are valid
+static bool rini_value_try_uint64(const rini_value *value, unsigned long long *result); // Get value as uint64, only non-negative integer values are valid
+static bool rini_value_try_double(const rini_value *value, double *result); // Get value as double, integer and decimal values are valid
+static bool rini_value_try_field(const rini_value *value, rini_field_type type, void *result); // Get value as field type, result not modified if not valid
+static unsigned int rini_field_size(rini_field_type type); // Get field type C type size
+
+static int rini_find_key(rini_data data, const char *key); // Find value position for provided key, returns -1 if not found
+static int rini_lookup_key(rini_data data, const char *key); // Find value position for provided key (getters, statistics updated), returns -1 if not found
+static int rini_lookup_section_key(rini_data data, const char *section, const char *key); // Find value position for provided key in section (getters, statistics updated), returns -1 if not found
+static int rini_find_section(rini_data data, const char *section); // Find section for provided name, returns -1 if not found
+static int rini_find_section_key(rini_data data, int section, const char *key); // Find value position for provided key in section, returns -1 if not found
+static int rini_add_section(rini_data *data, const char *name); // Add new section at the end, returns section index or -1 if fails
+static int rini_add_value(rini_data *data, int section, unsigned int position, const char *key, const char *text, const char *desc); // Add new value into section at position
+static void rini_update_value(rini_data *data, rini_value *value, const char *text, const char *desc); // Update value text and description (if provided)
+static int rini_set_value_entry(rini_data *data, const char *key, const char *text, const char *desc, bool is_text); // Set value entry for existing key or create a new one, single key lookup
+static int rini_set_section_value_entry(rini_data *data, const char *section, const char *key, const char *text, const char *desc, bool is_text); // Set section value entry for existing key or create a new one, single key lookup
+static bool rini_intern_grow(rini_intern *intern); // Grow intern table keys capacity and hash slots (geometrically), returns false if not possible
+static void rini_intern_insert(rini_intern *intern, unsigned int key_id); // Insert key id into intern table hash slots
+static bool rini_intern_map(rini_data *data); // Map data interned keys positions by key id, returns false on failure
+static bool rini_intern_reserve(rini_data *data, unsigned int count); // Reserve data interned keys positions (geometrically), returns false on failure
+static unsigned int rini_get_section_end(rini_data data, int section); // Get section position to add new values (after last value)
+static bool rini_grow_sections(rini_data *data); // Grow sections capacity (geometrically), returns false if not possible
+
+static int rini_index_find(rini_index index, const rini_value *values, unsigned int count, const char *key); // Find key position in values indexed, returns -1 if not found
+#if RINI_USE_KEY_HASH_INDEX
+static unsigned int rini_hash_key(const char *key); // Compute key hash (FNV-1a)
+static void rini_index_build(rini_index *index, const rini_value *values, unsigned int count, rini_arena *arena); // Build keys hash index for values
+static void rini_index_insert(rini_index *index, const rini_value *values, unsigned int position); // Insert value position into keys hash index
+static void rini_index_add(rini_index *index, const rini_value *values, unsigned int count, unsigned int position, rini_arena *arena); // Add value position into keys hash index, rebuilt if required
+static void rini_index_shift(rini_index *index, unsigned int position); // Move indexed positions from provided position (value inserted), no keys hashed
+#endif
 
 //----------------------------------------------------------------------------------
 // Module Functions Definition
@@ -327,668 +1147,4898 @@ static int rini_text_to_int(const char *text); // Convert text to int value (if
 // NOTE: Only key-value-description loaded, no empty lines or comments
 rini_data rini_load(const char *file_name)
 {
-    rini_data data = { 0 };
-    unsigned int value_counter = 0;
+    return rini_load_arena(file_name, NULL);
+}
 
-    // Init data to max capacity
-    data.capacity = RINI_MAX_VALUE_CAPACITY;
-    data.values = (rini_value *)RINI_CALLOC(RINI_MAX_VALUE_CAPACITY, sizeof(rini_value));
+// Load data from file (.ini) including all comments and empty lines
+rini_data rini_load_full(const char *file_name)
+{
+    unsigned int size = 0;
+#if defined(RINI_SUPPORT_STATS)
+    double start_time = rini_trace_begin("read");
+    char *buffer = rini_load_file_text(file_name, &size, NULL);
+    double read_time = rini_trace_end("read", size, start_time);
+#else
+    char *buffer = rini_load_file_text(file_name, &size, NULL);
+#endif
 
-    if (file_name != NULL)
-    {
-        FILE *rini_file = fopen(file_name, "rt");
+    // NOTE: Source hash is computed before parsing, buffer is tokenized in-place
+    unsigned long long hash = rini_hash_text(buffer, size);
 
-        if (rini_file != NULL)
-        {
-            char buffer[RINI_MAX_LINE_SIZE] = { 0 };    // Buffer to read every text line
+    rini_data data = rini_load_buffer(buffer, size, true, NULL);
+    data.source_size = size;
+    data.source_hash = hash;
 
-            // First pass to count valid lines
-            while (fgets(buffer, RINI_MAX_LINE_SIZE, rini_file))
-            {
-                // WARNING: fgets() keeps line endings, doesn't have any special options for converting line endings,
-                // but on Windows, when reading file 'rt', line endings are converted from \r\n to just \n
+#if defined(RINI_SUPPORT_STATS)
+    if (data.stats != NULL) data.stats->read_time = read_time;
+#endif
 
-                // Skip commented lines and empty lines
-                // NOTE: Also skipping sections delimiters
-                if ((buffer[0] != RINI_LINE_COMMENT_DELIMITER) &&
-                    (buffer[0] != RINI_LINE_SECTION_DELIMITER) &&
-                    (buffer[0] != '\n') && (buffer[0] != '\r') && (buffer[0] != '\0')) value_counter++;
-            }
+    return data;
+}
+
+// Load data from text buffer
+// NOTE: Comments and empty lines are ignored
+rini_data rini_load_from_memory(const char *text)
+{
+    return rini_load_from_memory_arena(text, NULL);
+}
 
-            // WARNING: No more values can be stored than its max capacity
-            data.count = (value_counter > RINI_MAX_VALUE_CAPACITY)? RINI_MAX_VALUE_CAPACITY : value_counter;
+// Load data from file (.ini) with all memory allocated from arena (NULL for heap, same as rini_load())
+// NOTE: Setters on returned data also allocate from arena, rini_unload() does not free arena memory
+rini_data rini_load_arena(const char *file_name, rini_arena *arena)
+{
+    unsigned int size = 0;
+#if defined(RINI_SUPPORT_STATS)
+    double start_time = rini_trace_begin("read");
+    char *buffer = rini_load_file_text(file_name, &size, arena);
+    double read_time = rini_trace_end("read", size, start_time);
+#else
+    char *buffer = rini_load_file_text(file_name, &size, arena);
+#endif
 
-            if (data.count > 0)
-            {
-                rewind(rini_file);
-                value_counter = 0;
+    // NOTE: Source hash is computed before parsing, buffer is tokenized in-place
+    unsigned long long hash = rini_hash_text(buffer, size);
 
-                // Second pass to read data
-                while (fgets(buffer, RINI_MAX_LINE_SIZE, rini_file))
-                {
-                    // WARNING: fgets() keeps line endings, doesn't have any special options for converting line endings,
-                    // but on Windows, when reading file 'rt', line endings are converted from \r\n to just \n
+    rini_data data = rini_load_buffer(buffer, size, false, arena);
+    data.source_size = size;
+    data.source_hash = hash;
 
-                    // Skip commented lines and empty lines
-                    if ((buffer[0] != RINI_LINE_COMMENT_DELIMITER) &&
-                        (buffer[0] != RINI_LINE_SECTION_DELIMITER) &&
-                        (buffer[0] != '\n') && (buffer[0] != '\r') && (buffer[0] != '\0'))
-                    {
-                        // Get key identifier string
-                        memset(data.values[value_counter].key, 0, RINI_MAX_KEY_SIZE);
-                        rini_read_key(buffer, data.values[value_counter].key);
-                        rini_read_value_text(buffer, data.values[value_counter].text, data.values[value_counter].desc, &data.values[value_counter].is_text);
+#if defined(RINI_SUPPORT_STATS)
+    if (data.stats != NULL) data.stats->read_time = read_time;
+#endif
 
-                        value_counter++;
+    return data;
+}
 
-                        // Stop reading if first count reached to avoid overflow in case count == RINI_MAX_VALUE_CAPACITY
-                        if (value_counter >= data.count) break;
-                    }
-                }
-            }
+// Load data from text buffer with all memory allocated from arena (NULL for heap, same as rini_load_from_memory())
+rini_data rini_load_from_memory_arena(const char *text, rini_arena *arena)
+{
+    char *buffer = NULL;
+    unsigned int size = 0;
 
-            fclose(rini_file);
+    if (text != NULL)
+    {
+        // NOTE: Text is copied once into an internal buffer (padded for blocks scanning), values point into it
+        size = (unsigned int)strlen(text);
+        buffer = (char *)rini_alloc(arena, size + 1 + RINI_SCAN_PADDING);
+
+        if (buffer != NULL)
+        {
+            memcpy(buffer, text, size);
+            memset(buffer + size, 0, 1 + RINI_SCAN_PADDING);
         }
+        else size = 0;
     }
 
+    rini_data data = rini_load_buffer(buffer, size, false, arena);
+
     return data;
 }
 
-// Load data from file (.ini) including all comments and empty lines
-rini_data rini_load_full(const char *file_name)
+// Create memory arena, first block reserved (0 for default size)
+// NOTE: Arena is reused for multiple loads, reset it when all its data is no longer required
+rini_arena rini_arena_create(unsigned int size)
 {
-    rini_data data = { 0 };
-    unsigned int value_counter = 0;
+    rini_arena arena = { 0 };
+    arena.block_size = (size > 0)? size : RINI_ARENA_BLOCK_SIZE;
 
-    // Init data to max capacity
-    data.capacity = RINI_MAX_VALUE_CAPACITY;
-    data.values = (rini_value *)RINI_CALLOC(RINI_MAX_VALUE_CAPACITY, sizeof(rini_value));
+    // First block reserved now, loading does not require heap allocations while it fits
+    rini_arena_add_block(&arena, arena.block_size);
 
-    if (file_name != NULL)
+    return arena;
+}
+
+// Reset memory arena, all data loaded with it released at once
+// NOTE: If more than one block was required, blocks are replaced by a single block of total size,
+// so same usage pattern fits in a single block afterwards (no heap allocations)
+void rini_arena_reset(rini_arena *arena)
+{
+    if ((arena->blocks != NULL) && (arena->blocks->next != NULL))
     {
-        FILE *rini_file = fopen(file_name, "rt");
+        unsigned int total_size = 0;
 
-        if (rini_file != NULL)
+        while (arena->blocks != NULL)
         {
-            char buffer[RINI_MAX_LINE_SIZE] = { 0 };    // Buffer to read every text line
+            rini_string_block *next = arena->blocks->next;
+            total_size += arena->blocks->size;
+            RINI_FREE(arena->blocks);
+            arena->blocks = next;
+        }
 
-            // First pass to count valid lines
-            while (fgets(buffer, RINI_MAX_LINE_SIZE, rini_file))
-            {
-                // WARNING: fgets() keeps line endings, doesn't have any special options for converting line endings,
-                // but on Windows, when reading file 'rt', line endings are converted from \r\n to just \n
+        if (total_size > arena->block_size) arena->block_size = total_size;
+        rini_arena_add_block(arena, arena->block_size);
+    }
+    else if (arena->blocks != NULL) arena->blocks->used = 0;
+}
 
-                // NOTE: Keeping all lines, including comments,
-                // useful for files editing without losing information
-                if (buffer[0] != '\0') value_counter++;
-            }
+// Unload memory arena, all blocks freed
+// WARNING: Data loaded with arena is no longer valid
+void rini_unload_arena(rini_arena *arena)
+{
+    while (arena->blocks != NULL)
+    {
+        rini_string_block *next = arena->blocks->next;
+        RINI_FREE(arena->blocks);
+        arena->blocks = next;
+    }
+}
 
-            // WARNING: No more values can be stored than its max capacity
-            data.count = (value_counter > RINI_MAX_VALUE_CAPACITY)? RINI_MAX_VALUE_CAPACITY : value_counter;
+#if defined(RINI_SUPPORT_STATS)
+// Get data statistics (counters and phases durations)
+// NOTE: Counters are not atomic, data shared by multiple threads could miss some updates
+rini_stats rini_get_stats(rini_data data)
+{
+    rini_stats stats = { 0 };
 
-            if (data.count > 0)
-            {
-                rewind(rini_file);
-                value_counter = 0;
+    if (data.stats != NULL) stats = *data.stats;
 
-                // Second pass to read data
-                while (fgets(buffer, RINI_MAX_LINE_SIZE, rini_file))
-                {
-                    // WARNING: fgets() keeps line endings, doesn't have any special options for converting line endings,
-                    // but on Windows, when reading file 'rt', line endings are converted from \r\n to just \n
+    return stats;
+}
 
-                    // NOTE: Keeping all lines, including comments,
-                    // useful for files editing without losing information
-                    if (buffer[0] != '\0')
-                    {
-                        if ((buffer[0] == '\n') || (buffer[0] == '\r'))  // Empty line
-                        {
-                            // Set entry as empty line: NULL, NULL, NULL
-                            memset(data.values[value_counter].key, 0, RINI_MAX_KEY_SIZE);   // NULL
-                            memset(data.values[value_counter].text, 0, RINI_MAX_TEXT_SIZE); // NULL
-                            memset(data.values[value_counter].desc, 0, RINI_MAX_DESC_SIZE); // NULL
-                        }
-                        else if (buffer[0] == RINI_LINE_COMMENT_DELIMITER)  // Comment line
-                        {
-                            // Measure comment line length
-                            int len = 0;
-                            char *buffer_ptr = (char *)buffer + 1; // Skip comment delimiter
-                            while ((buffer_ptr[len] != '\0') && (buffer_ptr[len] != '\r') && (buffer_ptr[len] != '\n')) len++;
-
-                            // Set entry as comment
-                            memset(data.values[value_counter].key, 0, RINI_MAX_KEY_SIZE);   // NULL
-                            memset(data.values[value_counter].text, 0, RINI_MAX_TEXT_SIZE); // NULL
-                            memset(data.values[value_counter].desc, 0, RINI_MAX_DESC_SIZE); // NULL
-                            if (len == 0)
-                            {
-                                // Set entry as empty comment: NULL, NULL, " "
-                                data.values[value_counter].desc[0] = ' ';
-                            }
-                            else
-                            {
-                                // Set entry as comment: NULL, NULL, "comment"
-                                // WARNING: In case of comment line, everything after delimiter is read (including spaces)
-                                memcpy(data.values[value_counter].desc, buffer_ptr, len);
-                            }
-                        }
-                        else
-                        {
-                            // Get key identifier string
-                            memset(data.values[value_counter].key, 0, RINI_MAX_KEY_SIZE);
-                            rini_read_key(buffer, data.values[value_counter].key);
-                            rini_read_value_text(buffer, data.values[value_counter].text, data.values[value_counter].desc, &data.values[value_counter].is_text);
-                        }
+// Reset data statistics
+void rini_reset_stats(rini_data data)
+{
+    if (data.stats != NULL) memset(data.stats, 0, sizeof(rini_stats));
+}
 
-                        value_counter++;
+// Set tracing callback for all data (NULL to disable)
+// NOTE: Callback is global, it receives phases spans (read, parse, index, save) and keys lookups
+void rini_set_trace_callback(rini_trace_callback callback, void *user_data)
+{
+    rini_trace = callback;
+    rini_trace_user_data = user_data;
+}
+#endif
 
-                        // Stop reading if first count reached to avoid overflow in case count == RINI_MAX_VALUE_CAPACITY
-                        if (value_counter >= data.count) break;
-                    }
-                }
-            }
+#if defined(RINI_SUPPORT_PARALLEL_LOAD)
+// Load data from file (*.ini) using multiple threads (0 for all cores)
+// NOTE: File is split in chunks at lines boundaries, every chunk is parsed by a thread into its own values,
+// values are merged in file order, sections and keys indexes are built once merged (first key wins, same as rini_load())
+// WARNING: Lines close to a chunk end are parsed on merging, blocks scanning could read next chunk text
+rini_data rini_load_parallel(const char *file_name, unsigned int thread_count)
+{
+    unsigned int size = 0;
+#if defined(RINI_SUPPORT_STATS)
+    double start_time = rini_trace_begin("read");
+    char *buffer = rini_load_file_text(file_name, &size, NULL);
+    double read_time = rini_trace_end("read", size, start_time);
+#else
+    char *buffer = rini_load_file_text(file_name, &size, NULL);
+#endif
 
-            fclose(rini_file);
-        }
-    }
+    if (thread_count == 0) thread_count = rini_get_cpu_count();
+    if (thread_count > (size/RINI_PARALLEL_MIN_CHUNK_SIZE)) thread_count = size/RINI_PARALLEL_MIN_CHUNK_SIZE;
+    if (thread_count > RINI_PARALLEL_MAX_THREADS) thread_count = RINI_PARALLEL_MAX_THREADS;
 
-    return data;
-}
+    rini_chunk *chunks = (thread_count > 1)? (rini_chunk *)RINI_CALLOC(thread_count, sizeof(rini_chunk)) : NULL;
 
-// Load data from text buffer
-// NOTE: Comments and empty lines are ignored
-rini_data rini_load_from_memory(const char *text)
-{
-    #define RINI_MAX_TEXT_LINES     RINI_MAX_VALUE_CAPACITY*2       // Consider possible comments and empty lines
+    // NOTE: Source hash is computed before parsing, buffer is tokenized in-place
+    unsigned long long hash = rini_hash_text(buffer, size);
+
+    // Not enough text (or memory) for multiple threads, loading in current thread
+    if (chunks == NULL)
+    {
+        rini_data data = rini_load_buffer(buffer, size, false, NULL);
+        data.source_size = size;
+        data.source_hash = hash;
+
+#if defined(RINI_SUPPORT_STATS)
+        if (data.stats != NULL) data.stats->read_time = read_time;
+#endif
+
+        return data;
+    }
+
+#if defined(RINI_SUPPORT_STATS)
+    start_time = rini_trace_begin("parse");
+#endif
 
     rini_data data = { 0 };
-    unsigned int value_counter = 0;
+    data.buffer = buffer;
+    data.source_size = size;
+    data.source_hash = hash;
 
-    // Init data to max capacity
-    data.capacity = RINI_MAX_VALUE_CAPACITY;
-    data.values = (rini_value *)RINI_CALLOC(RINI_MAX_VALUE_CAPACITY, sizeof(rini_value));
+    // Split text in chunks, chunks start at lines start
+    char *end = buffer + size;
 
-    if (text != NULL)
+    for (unsigned int i = 0; i < thread_count; i++)
     {
-        // Split text by line-breaks
-        const char *lines[RINI_MAX_TEXT_LINES] = { 0 };
-        int textSize = (int)strlen(text);
-        lines[0] = text;
-        int line_counter = 1;
+        rini_chunk *chunk = &chunks[i];
+        chunk->data.buffer = buffer;
+        chunk->start = (i == 0)? buffer : chunks[i - 1].chunk_end;
+        chunk->chunk_end = end;
 
-        for (int i = 0, k = 1; (i < textSize) && (line_counter < RINI_MAX_TEXT_LINES); i++)
+        if (i < (thread_count - 1))
         {
-            if (text[i] == '\n')
+            char *split = buffer + (unsigned long long)size*(i + 1)/thread_count;
+            if (split < chunk->start) split = chunk->start;
+
+            char *line_end = (char *)memchr(split, '\n', end - split);
+            chunk->chunk_end = (line_end != NULL)? line_end + 1 : end;
+
+            // Lines ending close to next chunk are left for merging, no text is read
+            // by a thread while other thread is writing it (tokens ends)
+            chunk->end = chunk->start;
+            char *limit = chunk->chunk_end - RINI_SCAN_PADDING;
+
+            if (limit > chunk->start)
             {
-                lines[k] = &text[i + 1]; // WARNING: next value is valid?
-                line_counter += 1;
-                k++;
+                chunk->end = limit;
+                while ((chunk->end > chunk->start) && (chunk->end[-1] != '\n')) chunk->end--;
             }
         }
+        else chunk->end = end;
+    }
 
-        // Count possible values in lines
-        for (int l = 0; l < line_counter; l++)
-        {
-            // Skip commented lines and empty lines
-            // NOTE: Also skipping sections delimiters
-            if ((lines[l][0] != RINI_LINE_COMMENT_DELIMITER) &&
-                (lines[l][0] != RINI_LINE_SECTION_DELIMITER) &&
-                (lines[l][0] != '\n') && (lines[l][0] != '\r') && (lines[l][0] != '\0')) value_counter++;
-        }
+    // Parse chunks, first chunk is parsed by current thread
+#if defined(_WIN32)
+    void *threads[RINI_PARALLEL_MAX_THREADS] = { 0 };
+    for (unsigned int i = 1; i < thread_count; i++) threads[i] = (void *)_beginthreadex(NULL, 0, rini_read_chunk, &chunks[i], 0, NULL);
+#else
+    pthread_t threads[RINI_PARALLEL_MAX_THREADS];
+    bool created[RINI_PARALLEL_MAX_THREADS] = { 0 };
+    for (unsigned int i = 1; i < thread_count; i++) created[i] = (pthread_create(&threads[i], NULL, rini_read_chunk, &chunks[i]) == 0);
+#endif
 
-        // WARNING: No more values can be stored than its max capacity
-        data.count = (value_counter > RINI_MAX_VALUE_CAPACITY)? RINI_MAX_VALUE_CAPACITY : value_counter;
+    rini_read_chunk(&chunks[0]);
 
-        // Process lines to get keys and values
-        if (data.count > 0)
+    for (unsigned int i = 1; i < thread_count; i++)
+    {
+        // NOTE: If thread could not be created, chunk is parsed by current thread
+#if defined(_WIN32)
+        if (threads[i] != NULL)
         {
-            value_counter = 0;
+            WaitForSingleObject(threads[i], 0xFFFFFFFF);
+            CloseHandle(threads[i]);
+        }
+        else rini_read_chunk(&chunks[i]);
+#else
+        if (created[i]) pthread_join(threads[i], NULL);
+        else rini_read_chunk(&chunks[i]);
+#endif
+    }
 
-            // Second pass to read data
-            for (int l = 0; l < line_counter; l++)
-            {
-                // Skip commented lines and empty lines
-                if ((lines[l][0] != RINI_LINE_COMMENT_DELIMITER) &&
-                    (lines[l][0] != RINI_LINE_SECTION_DELIMITER) &&
-                    (lines[l][0] != '\n') && (lines[l][0] != '\r') && (lines[l][0] != '\0'))
-                {
-                    // Get key identifier string
-                    memset(data.values[value_counter].key, 0, RINI_MAX_KEY_SIZE);
-                    rini_read_key(lines[l], data.values[value_counter].key);
-                    rini_read_value_text(lines[l], data.values[value_counter].text, data.values[value_counter].desc, &data.values[value_counter].is_text);
+    // Merge chunks values in file order, lines left on every chunk end are parsed now
+    unsigned int count = 0;
+    bool result = true;
 
-                    value_counter++;
+    for (unsigned int i = 0; i < thread_count; i++)
+    {
+        rini_chunk *chunk = &chunks[i];
+        if (result && chunk->result && (chunk->end < chunk->chunk_end)) chunk->result = rini_read_lines(&chunk->data, chunk->end, chunk->chunk_end, false);
 
-                    // Stop reading if first count reached to avoid overflow in case count == RINI_MAX_VALUE_CAPACITY
-                    if (value_counter >= data.count) break;
-                }
-            }
-        }
+        count += chunk->data.count;
+        if (!chunk->result) result = false; // Values capacity limit reached, next chunks are not merged
     }
 
+    while ((data.capacity < count) && rini_grow_values(&data)) { }
+
+    for (unsigned int i = 0; i < thread_count; i++)
+    {
+        rini_chunk *chunk = &chunks[i];
+        unsigned int chunk_count = chunk->data.count;
+
+        if (chunk_count > (data.capacity - data.count)) chunk_count = data.capacity - data.count;
+        if (chunk_count > 0) memcpy(data.values + data.count, chunk->data.values, chunk_count*sizeof(rini_value));
+
+        data.count += chunk_count;
+        RINI_FREE(chunk->data.values);
+    }
+
+    if (data.count < count) RINI_LOG("WARNING: Values capacity can not be increased, increase RINI_MAX_VALUE_CAPACITY\n");
+
+    RINI_FREE(chunks);
+
+#if defined(RINI_SUPPORT_STATS)
+    double parse_time = rini_trace_end("parse", size, start_time);
+
+    start_time = rini_trace_begin("index");
+#endif
+
+    rini_load_sections(&data);
+
+#if defined(RINI_SUPPORT_STATS)
+    double index_time = rini_trace_end("index", data.count, start_time);
+
+    if (data.stats != NULL)
+    {
+        data.stats->bytes_read += size;
+        data.stats->read_time = read_time;
+        data.stats->parse_time = parse_time;
+        data.stats->index_time = index_time;
+        if (!result || (data.count < count)) data.stats->truncations++;
+    }
+#endif
+
+    return data;
+}
+#endif
+
+// Parse stream lines, sending an event per line to callback
+// NOTE: Stream is read in blocks into a fixed buffer, only a line not fitting in buffer makes it grow,
+// parsed lines are not stored, memory usage does not depend on stream size
+int rini_parse_stream(rini_read_callback read_callback, void *reader, rini_event_callback callback, void *user_data)
+{
+    int result = 0;
+    unsigned int capacity = RINI_STREAM_BUFFER_SIZE;
+    unsigned int used = 0;          // Buffer bytes pending to be parsed (current line start)
+    unsigned int scanned = 0;       // Pending bytes already scanned for line end
+    bool ended = false;
+
+    // NOTE: Padding is required for blocks scanning past line end
+    char *buffer = ((read_callback != NULL) && (callback != NULL))? (char *)RINI_CALLOC(capacity + RINI_SCAN_PADDING, 1) : NULL;
+    if (buffer == NULL) result = -1;
+
+    while ((result == 0) && !ended)
+    {
+        // Line does not fit in buffer, buffer size is doubled
+        if (used == capacity)
+        {
+            char *grown = (char *)RINI_CALLOC(capacity*2 + RINI_SCAN_PADDING, 1);
+
+            if (grown == NULL)
+            {
+                RINI_LOG("WARNING: Stream buffer can not be increased, line too long\n");
+                result = -1;
+                break;
+            }
+
+            memcpy(grown, buffer, used);
+            RINI_FREE(buffer);
+            buffer = grown;
+            capacity *= 2;
+        }
+
+        int bytes = read_callback(reader, buffer + used, capacity - used);
+
+        if (bytes < 0)
+        {
+            RINI_LOG("WARNING: Stream can not be read\n");
+            result = -1;
+            break;
+        }
+        else if (bytes == 0) ended = true;
+
+        used += (unsigned int)bytes;
+
+        // Parse complete lines, last line (not ended) is only parsed on stream end
+        char *line = buffer;
+        char *end = buffer + used;
+        char *ptr = buffer + scanned;
+
+        while ((result == 0) && (line < end))
+        {
+            char *line_end = (char *)memchr(ptr, '\n', end - ptr);
+
+            if (line_end == NULL)
+            {
+                if (ended) line_end = end;
+                else break;
+            }
+
+            ptr = (line_end < end)? line_end + 1 : end;
+
+            // Remove carriage return in case of Windows line endings
+            if ((line_end > line) && (line_end[-1] == '\r')) line_end--;
+
+            if (rini_read_event(line, line_end, callback, user_data) != 0) result = 1;
+
+            line = ptr;
+        }
+
+        // Move pending line to buffer start, already scanned bytes are not scanned again
+        // NOTE: Pending line was fully scanned (no line end found), next scan starts at new bytes
+        used = (unsigned int)(end - line);
+        scanned = used;
+        if ((used > 0) && (line > buffer)) memmove(buffer, line, used);
+    }
+
+    RINI_FREE(buffer);
+
+    return result;
+}
+
+// Parse opened file lines (streaming), file is read from current position
+int rini_parse_file(FILE *file, rini_event_callback callback, void *user_data)
+{
+    int result = -1;
+
+    if (file != NULL) result = rini_parse_stream(rini_read_file_stream, file, callback, user_data);
+
+    return result;
+}
+
+// Parse file descriptor lines (streaming), pipes and sockets are supported
+int rini_parse_fd(int fd, rini_event_callback callback, void *user_data)
+{
+    int result = -1;
+
+    if (fd >= 0) result = rini_parse_stream(rini_read_fd_stream, &fd, callback, user_data);
+
+    return result;
+}
+
+// Reload data from file only if file has changed since last check
+// NOTE: File modification time and size are checked first, file content is read and hashed only if they changed
+// (or file was modified in last check second), file is parsed only if content hash changed.
+// If reloaded, previous data is unloaded and changed keys list is provided (if requested)
+int rini_reload(rini_data *data, const char *file_name, rini_watch *watch, rini_change_list *changes)
+{
+    int result = -1;
+    struct stat file_stat = { 0 };
+
+    if (changes != NULL) memset(changes, 0, sizeof(rini_change_list));
+
+    if ((data != NULL) && (file_name != NULL) && (watch != NULL) && (stat(file_name, &file_stat) == 0))
+    {
+        long long mtime = (long long)file_stat.st_mtime;
+        long long size = (long long)file_stat.st_size;
+        long long check_time = (long long)time(NULL);
+
+        // File state not changed and not modified after last check, file is not read
+        if (watch->valid && (mtime == watch->mtime) && (size == watch->size) && (mtime < watch->check_time)) result = 0;
+        else
+        {
+            unsigned int text_size = 0;
+            char *text = rini_load_file_text(file_name, &text_size, NULL);
+
+            if ((text != NULL) || (size == 0))
+            {
+                unsigned long long hash = rini_hash_text(text, text_size);
+                bool changed = !watch->valid || (hash != watch->hash);
+
+                watch->mtime = mtime;
+                watch->size = size;
+                watch->check_time = check_time;
+                watch->hash = hash;
+                watch->valid = true;
+
+                if (changed)
+                {
+                    rini_data loaded = rini_load_buffer(text, text_size, false, NULL);
+                    loaded.source_size = text_size;
+                    loaded.source_hash = hash;
+                    loaded.generation = data->generation + 1; // Previous data handles are stale
+                    if (data->intern != NULL) rini_intern_data(&loaded, data->intern);
+
+                    // Changed keys: added and modified keys in file order, then removed keys
+                    // NOTE: Only value text changes are considered, descriptions are not compared
+                    if (changes != NULL) rini_diff_keys(*data, loaded, false, changes);
+
+                    rini_unload(data);
+                    *data = loaded;
+                    result = 1;
+                }
+                else
+                {
+                    RINI_FREE(text);
+                    result = 0;
+                }
+            }
+        }
+    }
+
+    return result;
+}
+
+// Unload changes list from memory
+void rini_unload_changes(rini_change_list *changes)
+{
+    RINI_FREE(changes->changes);
+    RINI_FREE(changes->strings);
+
+    changes->changes = NULL;
+    changes->count = 0;
+    changes->strings = NULL;
+}
+
+// Compare data keys with other data keys, changes list provided must be unloaded
+// NOTE: Changes from data to other: added and modified keys in other order, then removed keys,
+// keys are compared per section using keys indexes (linear time)
+int rini_diff(rini_data data, rini_data other, rini_change_list *changes)
+{
+    int result = -1;
+
+    if (changes != NULL) result = rini_diff_keys(data, other, true, changes);
+
+    return result;
+}
+
+// Three-way merge, theirs changes from base are applied to ours
+// NOTE: Ours lines (comments, empty lines and sections) and order are kept, keys added by theirs are
+// placed after section last key (new sections at the end). In case of conflict (same key changed
+// differently by ours and theirs, or changed by one and removed by the other), ours is kept and
+// conflict is added to conflicts list (if provided), with theirs change type.
+// Merged text is written and loaded again (full), same as saving merged data and loading it with rini_load_full()
+rini_data rini_merge(rini_data base, rini_data ours, rini_data theirs, rini_change_list *conflicts)
+{
+    rini_data data = { 0 };
+    rini_change_list list = { 0 };
+    unsigned int strings_size = 0;
+
+    // Measure merged text size and conflicts
+    unsigned int size = rini_merge_text(base, ours, theirs, NULL, 0, &list, &strings_size);
+    unsigned int conflicts_count = list.count;
+
+    char *buffer = (char *)RINI_MALLOC(size + 1 + RINI_SCAN_PADDING);
+
+    if (conflicts_count > 0)
+    {
+        list.changes = (rini_change *)RINI_MALLOC(conflicts_count*sizeof(rini_change));
+        list.strings = (char *)RINI_MALLOC(strings_size);
+    }
+
+    if ((buffer != NULL) && ((conflicts_count == 0) || ((list.changes != NULL) && (list.strings != NULL))))
+    {
+        list.count = 0;
+        strings_size = 0;
+        rini_merge_text(base, ours, theirs, buffer, size + 1, &list, &strings_size);
+        memset(buffer + size, 0, 1 + RINI_SCAN_PADDING);
+
+        data = rini_load_buffer(buffer, size, true, NULL);
+    }
+    else
+    {
+        RINI_LOG("WARNING: Merged data can not be allocated\n");
+        RINI_FREE(buffer);
+        rini_unload_changes(&list);
+        data = rini_load_buffer(NULL, 0, true, NULL);
+    }
+
+    if (conflicts != NULL) *conflicts = list;
+    else rini_unload_changes(&list);
+
     return data;
 }
 
 // Save data to file (*.ini)
+// NOTE: All lines are written into one buffer and saved to file at once
 void rini_save(rini_data data, const char *file_name)
 {
-    FILE *rini_file = fopen(file_name, "wt");
+#if defined(RINI_SUPPORT_STATS)
+    double start_time = rini_trace_begin("save");
+#endif
+    unsigned int size = 0;
+    char *text = rini_save_text(data, &size);
+
+    if (text != NULL)
+    {
+        if (rini_save_file_text(file_name, text, size, false, false) == 0) RINI_STATS_ADD(data.stats, bytes_written, size);
+
+        RINI_FREE(text);
+    }
+
+#if defined(RINI_SUPPORT_STATS)
+    double save_time = rini_trace_end("save", size, start_time);
+    RINI_STATS_ADD(data.stats, save_time, save_time);
+#endif
+}
+
+// Save data to file (*.ini) atomically, returns 0 on success
+// NOTE: Data is saved into a temporary file (same directory) that replaces original file once completely written,
+// a reader never sees a partially written file, original file is kept if saving fails
+// WARNING: Concurrent writers of the same file must be synchronized by user, they share the temporary file
+int rini_save_atomic(rini_data data, const char *file_name)
+{
+    int result = -1;
+#if defined(RINI_SUPPORT_STATS)
+    double start_time = rini_trace_begin("save");
+    unsigned int saved_size = 0;
+#endif
+
+    if (file_name != NULL)
+    {
+        unsigned int size = 0;
+        char *text = rini_save_text(data, &size);
+
+        if (text != NULL)
+        {
+            result = rini_save_file_atomic(file_name, text, size);
+
+            if (result != 0) RINI_LOG("WARNING: Failed saving file atomically, original file not modified: %s\n", file_name);
+#if defined(RINI_SUPPORT_STATS)
+            else saved_size = size;
+#endif
+        }
+
+        RINI_FREE(text);
+    }
+
+#if defined(RINI_SUPPORT_STATS)
+    double save_time = rini_trace_end("save", saved_size, start_time);
+    RINI_STATS_ADD(data.stats, bytes_written, saved_size);
+    RINI_STATS_ADD(data.stats, save_time, save_time);
+#endif
+
+    return result;
+}
+
+// Save only changed values into source file (incremental patch), returns 0 on success
+// NOTE: Unchanged lines keep their original bytes, updated lines are rewritten and new lines inserted,
+// if updated lines keep their size they are written in place, otherwise file is rewritten from first change
+// (file shrinking is saved into a temporary file replacing original one). File is completely saved if it
+// does not match loaded source (size and content hash), i.e. modified or data not loaded from that file
+// WARNING: Readers could see a partially patched file, use rini_save_atomic() if that is a problem
+int rini_save_patch(rini_data *data, const char *file_name)
+{
+    int result = -1;
+    unsigned int first = 0;
+    bool matched = false;       // File matches loaded source, it can be patched
+#if defined(RINI_SUPPORT_STATS)
+    double start_time = rini_trace_begin("save");
+    unsigned int written = 0;   // Bytes written to file
+#endif
+
+    // Find first value requiring patching, all previous lines are kept
+    while ((first < data->count) && data->values[first].in_source && !data->values[first].is_dirty) first++;
+
+    FILE *rini_file = (file_name != NULL)? fopen(file_name, "r+b") : NULL;
+    char *src = NULL;
 
     if (rini_file != NULL)
     {
-        char valuestr[RINI_MAX_TEXT_SIZE + 2] = { 0 }; // Useful for text processing, adding quotation marks if required
+        fseek(rini_file, 0, SEEK_END);
+        long file_size = ftell(rini_file);
+
+        // NOTE: File is read completely to verify its content, external changes keeping file size are detected
+        if ((data->source_size > 0) && (file_size == (long)data->source_size))
+        {
+            src = (char *)RINI_MALLOC(data->source_size + 1);
 
-        for (unsigned int i = 0; i < data.count; i++)
+            matched = (src != NULL) && (fseek(rini_file, 0, SEEK_SET) == 0) && (fread(src, 1, data->source_size, rini_file) == data->source_size) &&
+                (rini_hash_text(src, data->source_size) == data->source_hash);
+        }
+
+        if (!matched) fclose(rini_file); // File does not match loaded source, complete saving required
+        else if (first == data->count) result = 0; // Nothing to patch
+        else
         {
-            if ((data.values[i].key[0] == '\0') && (data.values[i].text[0] == '\0'))
+            // Check if updated lines keep their size and no lines have been added
+            bool in_place = true;
+            unsigned int max_size = 0;
+
+            for (unsigned int i = first; (i < data->count) && in_place; i++)
             {
-                if (data.values[i].desc[0] == '\0') fprintf(rini_file, "\n");  // Empty line
-                else if ((data.values[i].desc[0] == ' ') && (data.values[i].desc[1] == '\0')) // Empty comment line
-                    fprintf(rini_file, "%c\n", RINI_LINE_COMMENT_DELIMITER);
-                else fprintf(rini_file, "%c%s\n", RINI_LINE_COMMENT_DELIMITER, data.values[i].desc); // Comment line
+                const rini_value *value = &data->values[i];
+
+                if (!value->in_source) in_place = false;
+                else if (value->is_dirty)
+                {
+                    // NOTE: Line ending not considered, it is kept
+                    unsigned int size = rini_write_value(value, NULL, 0, 0) - 1;
+                    if (size != value->src_size) in_place = false;
+                    else if (size > max_size) max_size = size;
+                }
             }
-            else
+
+            if (in_place)
             {
-                memset(valuestr, 0, RINI_MAX_TEXT_SIZE + 2);
-#if RINI_USE_TEXT_QUOTATION_MARKS
-                // Add quotation marks if required
-                if (data.values[i].is_text) snprintf(valuestr, RINI_MAX_TEXT_SIZE + 2, "%c%s%c", RINI_VALUE_QUOTATION_MARKS, data.values[i].text, RINI_VALUE_QUOTATION_MARKS);
-#else
-                snprintf(valuestr, RINI_MAX_TEXT_SIZE + 2, "%s", data.values[i].text);
-#endif
-                // Add description if required
-                if (data.values[i].desc[0] != '\0')
+                // Write updated lines over original ones, no other byte is touched
+                // NOTE: Source text is updated same as file, to get patched file hash
+                char *line = (char *)RINI_MALLOC(max_size + 2);
+
+                if (line != NULL)
                 {
-                    fprintf(rini_file, "%-*s %c %-*s %c %s\n", RINI_KEY_SPACING, data.values[i].key, RINI_VALUE_DELIMITER,
-                        RINI_VALUE_SPACING, data.values[i].is_text? valuestr : data.values[i].text,
-                        RINI_DESCRIPTION_DELIMITER, data.values[i].desc);
+                    result = 0;
+
+                    for (unsigned int i = first; (i < data->count) && (result == 0); i++)
+                    {
+                        rini_value *value = &data->values[i];
+
+                        if (value->is_dirty)
+                        {
+                            rini_write_value(value, line, max_size + 2, 0);
+
+                            if ((fseek(rini_file, (long)value->src_offset, SEEK_SET) == 0) && (fwrite(line, 1, value->src_size, rini_file) == value->src_size))
+                            {
+                                memcpy(src + value->src_offset, line, value->src_size);
+                                value->is_dirty = false;
+#if defined(RINI_SUPPORT_STATS)
+                                written += value->src_size;
+#endif
+                            }
+                            else result = -1;
+                        }
+                    }
+
+                    if (result == 0) data->source_hash = rini_hash_text(src, data->source_size);
+
+                    RINI_FREE(line);
                 }
-                else
+            }
+            else
+            {
+                // Splice original text from first change: unchanged bytes are copied,
+                // updated lines replaced and new lines inserted
+                unsigned int start = 0;
+                if (data->values[first].in_source) start = data->values[first].src_offset;
+                else if (first > 0) start = data->values[first - 1].src_offset + data->values[first - 1].src_size;
+
+                unsigned int src_size = data->source_size - start;
+                unsigned int size = rini_patch_text(data, first, src + start, start, NULL, 0);
+
+                // Patched file text: text before first change is kept, patched text follows
+                char *text = (char *)RINI_MALLOC(start + size + 2);
+
+                if (text != NULL)
                 {
-                    // No description required
-                    fprintf(rini_file, "%-*s %c %s\n", RINI_KEY_SPACING, data.values[i].key, RINI_VALUE_DELIMITER,
-                        data.values[i].is_text? valuestr : data.values[i].text);
+                    memcpy(text, src, start);
+                    rini_patch_text(data, first, src + start, start, text + start, size + 2);
+
+                    if (size >= src_size)
+                    {
+                        // File grows, only text from first change is written
+                        if ((fseek(rini_file, (long)start, SEEK_SET) == 0) && (fwrite(text + start, 1, size, rini_file) == size)) result = 0;
+                    }
+                    else
+                    {
+                        // File shrinks, it must be truncated: complete text is saved into a temporary file
+                        // replacing original one, original file is kept if saving fails
+                        fclose(rini_file);
+                        rini_file = NULL;
+
+                        result = rini_save_file_atomic(file_name, text, start + size);
+                    }
+
+                    if (result == 0)
+                    {
+                        data->source_size = start + size;
+                        data->source_hash = rini_hash_text(text, start + size);
+#if defined(RINI_SUPPORT_STATS)
+                        written = (size >= src_size)? size : (start + size);
+#endif
+                    }
+
+                    RINI_FREE(text);
                 }
             }
+
+            if (result != 0)
+            {
+                // NOTE: File state is unknown, next saving will be complete
+                RINI_LOG("WARNING: Failed patching file: %s\n", file_name);
+                data->source_size = 0;
+            }
         }
 
-        fclose(rini_file);
+        if (matched && (rini_file != NULL) && (fclose(rini_file) != 0)) result = -1;
+    }
+
+    RINI_FREE(src);
+
+    // Source file not available or not matching, complete saving required
+    if (!matched && (file_name != NULL)) result = rini_save_source(data, file_name);
+
+#if defined(RINI_SUPPORT_STATS)
+    if (!matched && (result == 0)) written = data->source_size;
+
+    double save_time = rini_trace_end("save", written, start_time);
+    RINI_STATS_ADD(data->stats, bytes_written, written);
+    RINI_STATS_ADD(data->stats, save_time, save_time);
+#endif
+
+    return result;
+}
+
+// Save data to text buffer ('\0' EOL)
+// WARNING: Returned buffer is static, not reentrant, use rini_save_to_buffer() for concurrent serialization
+char *rini_save_to_memory(rini_data data)
+{
+    // NOTE: Using a static buffer to avoid de-allocation requirement on user side
+    static char text[RINI_MAX_TEXT_FILE_SIZE] = { 0 };
+
+    // Verify required data size is smaller than memory buffer size
+    unsigned int required_size = rini_save_to_buffer(data, text, RINI_MAX_TEXT_FILE_SIZE);
+    if (required_size >= RINI_MAX_TEXT_FILE_SIZE)
+    {
+        RINI_LOG("WARNING: Required data.ini size is bigger than max supported memory size, increase RINI_MAX_TEXT_FILE_SIZE\n");
+        RINI_STATS_ADD(data.stats, truncations, 1);
+    }
+
+    return text;
+}
+
+// Save data to provided text buffer ('\0' EOL), returns required size (not including '\0')
+// NOTE: Buffer is never overflowed, text is truncated if it does not fit,
+// buffer can be NULL (with size 0) to measure required size, function is reentrant
+unsigned int rini_save_to_buffer(rini_data data, char *buffer, unsigned int size)
+{
+    unsigned int offset = 0;
+
+    for (unsigned int i = 0; i < data.count; i++) offset += rini_write_value(&data.values[i], buffer, size, offset);
+
+    if ((buffer != NULL) && (size > 0)) buffer[(offset < size)? offset : (size - 1)] = '\0';
+
+    return offset;
+}
+
+// Unload data
+void rini_unload(rini_data *data)
+{
+    // Free strings arena blocks
+    while (data->strings != NULL)
+    {
+        rini_string_block *next = data->strings->next;
+        RINI_FREE(data->strings);
+        data->strings = next;
+    }
+
+    // Free sections keys indexes
+    // NOTE: Memory allocated from arena is not freed, it is released on arena reset
+    for (unsigned int i = 0; i < data->section_count; i++) rini_free(data->arena, data->sections[i].index.slots);
+
+    rini_free(data->arena, data->values);
+    rini_free(data->arena, data->index.slots);
+    rini_free(data->arena, data->sections);
+    rini_free(data->arena, data->buffer);
+    rini_free(data->arena, data->stats);
+    rini_free(data->arena, data->key_positions);
+
+    data->values = NULL;
+    data->count = 0;
+    data->capacity = 0;
+    memset(&data->index, 0, sizeof(rini_index));
+    data->sections = NULL;
+    data->section_count = 0;
+    data->section_capacity = 0;
+    data->buffer = NULL;
+    data->arena = NULL;
+    data->stats = NULL;
+    data->intern = NULL;
+    data->key_positions = NULL;
+    data->key_position_count = 0;
+    data->key_position_capacity = 0;
+    data->generation++; // Values removed, handles are stale
+}
+
+#if defined(RINI_SUPPORT_SNAPSHOTS)
+// Create snapshot from data, data is owned by snapshot (unloaded with it)
+// NOTE: Returned snapshot holds one reference, transferred on publishing or released by user,
+// snapshot data has no statistics, counters are not atomic and readers getters run concurrently
+rini_snapshot *rini_snapshot_create(rini_data data)
+{
+    rini_snapshot *snapshot = (rini_snapshot *)RINI_MALLOC(sizeof(rini_snapshot));
+
+    if (snapshot != NULL)
+    {
+        rini_free(data.arena, data.stats);
+        data.stats = NULL;
+
+        snapshot->data = data;
+        snapshot->refs = 1;
+    }
+    else rini_unload(&data);
+
+    return snapshot;
+}
+
+// Load snapshot from file (*.ini)
+// NOTE: Loading is done by calling thread, readers are not affected until snapshot is published,
+// an empty file is valid (empty snapshot), only a file that can not be read fails
+rini_snapshot *rini_snapshot_load(const char *file_name)
+{
+    rini_snapshot *snapshot = NULL;
+    bool empty = false;
+
+    // NOTE: Empty file loads no buffer, it must be checked to not be considered a read failure
+    FILE *file = (file_name != NULL)? fopen(file_name, "rb") : NULL;
+
+    if (file != NULL)
+    {
+        fseek(file, 0, SEEK_END);
+        empty = (ftell(file) == 0);
+        fclose(file);
+    }
+
+    rini_data data = rini_load(file_name);
+
+    if ((data.buffer != NULL) || (empty && (data.values != NULL))) snapshot = rini_snapshot_create(data);
+    else rini_unload(&data);
+
+    return snapshot;
+}
+
+// Publish snapshot as current one, snapshot reference is transferred to shared
+// NOTE: Previous snapshot is released once readers acquiring it have got their reference,
+// it is unloaded by last reader releasing it, publishing NULL releases current snapshot
+// WARNING: Publisher waits for readers in the middle of acquiring (a few instructions), readers never wait
+void rini_snapshot_publish(rini_shared *shared, rini_snapshot *snapshot)
+{
+    // Publishers are serialized
+    while (RINI_ATOMIC_EXCHANGE(&shared->publishing, 1) != 0) RINI_YIELD();
+
+    rini_snapshot *previous = (rini_snapshot *)RINI_ATOMIC_EXCHANGE_PTR(&shared->current, snapshot);
+
+    // Flip readers epoch, new readers get new snapshot, only readers registered on previous epoch
+    // could have read previous snapshot pointer without getting a reference yet
+    long epoch = RINI_ATOMIC_LOAD(&shared->epoch);
+    RINI_ATOMIC_EXCHANGE(&shared->epoch, 1 - epoch);
+
+    while (RINI_ATOMIC_LOAD(&shared->readers[epoch]) != 0) RINI_YIELD();
+
+    RINI_ATOMIC_EXCHANGE(&shared->publishing, 0);
+
+    rini_snapshot_release(previous);
+}
+
+// Acquire current snapshot, it must be released once done
+// NOTE: Lock-free, reader registers on current epoch only while getting snapshot reference
+rini_snapshot *rini_snapshot_acquire(rini_shared *shared)
+{
+    rini_snapshot *snapshot = NULL;
+    long epoch = 0;
+
+    // Register reader on current epoch, registration is retried if epoch was flipped meanwhile
+    // NOTE: Publisher flipping epoch after registration waits for this reader
+    while (true)
+    {
+        epoch = RINI_ATOMIC_LOAD(&shared->epoch);
+        RINI_ATOMIC_ADD(&shared->readers[epoch], 1);
+
+        if (RINI_ATOMIC_LOAD(&shared->epoch) == epoch) break;
+
+        RINI_ATOMIC_ADD(&shared->readers[epoch], -1);
+    }
+
+    snapshot = (rini_snapshot *)RINI_ATOMIC_LOAD_PTR(&shared->current);
+    if (snapshot != NULL) RINI_ATOMIC_ADD(&snapshot->refs, 1);
+
+    RINI_ATOMIC_ADD(&shared->readers[epoch], -1);
+
+    return snapshot;
+}
+
+// Release snapshot reference, snapshot is unloaded if it was the last one
+void rini_snapshot_release(rini_snapshot *snapshot)
+{
+    if ((snapshot != NULL) && (RINI_ATOMIC_ADD(&snapshot->refs, -1) == 1))
+    {
+        rini_unload(&snapshot->data);
+        RINI_FREE(snapshot);
+    }
+}
+#endif
+
+#if defined(RINI_SUPPORT_BINARY)
+// Save data to compiled binary file, returns 0 on success
+// NOTE: File is replaced atomically (temporary file renamed), processes with previous file mapped are not affected
+int rini_save_binary(rini_data data, const char *file_name)
+{
+    int result = -1;
+
+    if (file_name != NULL)
+    {
+        unsigned int size = rini_save_binary_to_buffer(data, NULL, 0);
+        unsigned int name_len = (unsigned int)strlen(file_name);
+        unsigned char *buffer = (unsigned char *)RINI_MALLOC(size);
+        char *temp_file_name = (char *)RINI_MALLOC(name_len + sizeof(RINI_SAVE_TEMP_FILE_EXT));
+
+        if ((buffer != NULL) && (temp_file_name != NULL))
+        {
+            memcpy(temp_file_name, file_name, name_len);
+            memcpy(temp_file_name + name_len, RINI_SAVE_TEMP_FILE_EXT, sizeof(RINI_SAVE_TEMP_FILE_EXT));
+
+            rini_save_binary_to_buffer(data, buffer, size);
+
+            if (rini_save_file_text(temp_file_name, (const char *)buffer, size, RINI_USE_SAVE_FILE_SYNC, true) == 0)
+            {
+                result = rini_replace_file(file_name, temp_file_name);
+            }
+
+            if (result != 0)
+            {
+                RINI_LOG("WARNING: Failed saving binary file: %s\n", file_name);
+                remove(temp_file_name);
+            }
+        }
+
+        RINI_FREE(buffer);
+        RINI_FREE(temp_file_name);
+    }
+
+    return result;
+}
+
+// Save data to compiled binary buffer, returns required size
+// NOTE: Pass NULL buffer to get required size, binary is only written if buffer size is enough,
+// only key-value entries are saved (comments and empty lines are not required for queries)
+unsigned int rini_save_binary_to_buffer(rini_data data, void *buffer, unsigned int size)
+{
+    unsigned int value_count = 0;
+    unsigned int strings_size = 0;
+
+    for (unsigned int s = 0; s < data.section_count; s++) strings_size += (unsigned int)strlen(data.sections[s].name) + 1;
+
+    for (unsigned int i = 0; i < data.count; i++)
+    {
+        const rini_value *value = &data.values[i];
+
+        if ((value->key_len > 0) && !value->is_section)
+        {
+            value_count++;
+            strings_size += value->key_len + value->text_len + value->desc_len + 3;
+        }
+    }
+
+    // NOTE: Hash tables load factor is kept under 0.5, probing sequences remain short
+    unsigned int slot_count = 16;
+    while (slot_count < value_count*2) slot_count *= 2;
+
+    rini_binary_header header = { 0 };
+    memcpy(header.magic, RINI_BINARY_MAGIC, 4);
+    header.version = RINI_BINARY_VERSION;
+    header.endianness = RINI_BINARY_ENDIANNESS;
+    header.value_count = value_count;
+    header.section_count = data.section_count;
+    header.slot_count = slot_count;
+    header.strings_size = strings_size;
+    header.values_offset = sizeof(rini_binary_header);
+    header.sections_offset = header.values_offset + value_count*sizeof(rini_binary_value);
+    header.keys_offset = header.sections_offset + data.section_count*sizeof(rini_binary_section);
+    header.section_keys_offset = header.keys_offset + slot_count*sizeof(unsigned int);
+    header.strings_offset = header.section_keys_offset + slot_count*sizeof(unsigned int);
+    header.size = (header.strings_offset + strings_size + 7) & ~7u;
+
+    if ((buffer != NULL) && (size >= header.size))
+    {
+        unsigned char *binary = (unsigned char *)buffer;
+        memset(binary, 0, header.size);
+
+        rini_binary_value *values = (rini_binary_value *)(binary + header.values_offset);
+        rini_binary_section *sections = (rini_binary_section *)(binary + header.sections_offset);
+        unsigned int *keys = (unsigned int *)(binary + header.keys_offset);
+        unsigned int *section_keys = (unsigned int *)(binary + header.section_keys_offset);
+        char *strings = (char *)(binary + header.strings_offset);
+        unsigned int offset = 0;
+        unsigned int count = 0;
+
+        for (unsigned int s = 0; s < data.section_count; s++)
+        {
+            const rini_section *section = &data.sections[s];
+
+            sections[s].name = offset;
+            sections[s].name_len = (unsigned int)strlen(section->name);
+            memcpy(strings + offset, section->name, sections[s].name_len + 1);
+            offset += sections[s].name_len + 1;
+
+            for (unsigned int i = section->first; i < (section->first + section->count); i++)
+            {
+                const rini_value *value = &data.values[i];
+
+                if ((value->key_len == 0) || value->is_section) continue;
+
+                rini_binary_value *bin = &values[count];
+
+                bin->key = offset;
+                bin->key_len = value->key_len;
+                memcpy(strings + offset, value->key, value->key_len + 1);
+                offset += value->key_len + 1;
+                bin->text = offset;
+                bin->text_len = value->text_len;
+                memcpy(strings + offset, value->text, value->text_len + 1);
+                offset += value->text_len + 1;
+                bin->desc = offset;
+                bin->desc_len = value->desc_len;
+                memcpy(strings + offset, value->desc, value->desc_len + 1);
+                offset += value->desc_len + 1;
+
+                switch (value->type)
+                {
+                    case RINI_VALUE_INT: bin->typed = (unsigned long long)value->typed.int_value; break;
+                    case RINI_VALUE_UINT: bin->typed = value->typed.uint_value; break;
+                    case RINI_VALUE_FLOAT: memcpy(&bin->typed, &value->typed.float_value, sizeof(double)); break;
+                    case RINI_VALUE_BOOL: bin->typed = value->typed.bool_value? 1 : 0; break;
+                    default: break;
+                }
+
+                bin->section = s;
+                bin->hash = (unsigned int)rini_hash_text(value->key, value->key_len);
+                bin->type = (unsigned int)value->type;
+                bin->is_text = value->is_text? 1 : 0;
+
+                // NOTE: In case of duplicate keys, first key is kept (same as rini_get_value())
+                unsigned int slot = rini_binary_probe(keys, slot_count - 1, values, strings, bin->hash, -1, value->key, value->key_len);
+                if (keys[slot] == 0) keys[slot] = count + 1;
+
+                slot = rini_binary_probe(section_keys, slot_count - 1, values, strings, bin->hash, (int)s, value->key, value->key_len);
+                if (section_keys[slot] == 0) section_keys[slot] = count + 1;
+
+                count++;
+            }
+        }
+
+        header.checksum = rini_hash_text((const char *)binary + sizeof(rini_binary_header), header.size - sizeof(rini_binary_header));
+        memcpy(binary, &header, sizeof(rini_binary_header));
+    }
+
+    return header.size;
+}
+
+// Load compiled binary file, memory-mapped (read-only, pages shared between processes)
+// NOTE: Binary is validated (header, layout, checksum), data is NULL if not valid
+rini_binary rini_load_binary(const char *file_name)
+{
+    rini_binary binary = { 0 };
+    unsigned int size = 0;
+    const unsigned char *data = rini_map_file(file_name, &size);
+
+    if (data != NULL)
+    {
+        if (rini_binary_check(data, size))
+        {
+            binary.data = data;
+            binary.size = size;
+            binary.mapped = true;
+        }
+        else
+        {
+            RINI_LOG("WARNING: Binary file not valid: %s\n", file_name);
+            rini_unmap_file(data, size);
+        }
+    }
+
+    return binary;
+}
+
+// Load compiled binary from buffer, buffer is not copied (must be kept while binary is used)
+// NOTE: Binary is validated (header, layout, checksum), data is NULL if not valid
+rini_binary rini_load_binary_from_memory(const void *buffer, unsigned int size)
+{
+    rini_binary binary = { 0 };
+
+    if (rini_binary_check((const unsigned char *)buffer, size))
+    {
+        binary.data = (const unsigned char *)buffer;
+        binary.size = size;
+    }
+    else RINI_LOG("WARNING: Binary data not valid\n");
+
+    return binary;
+}
+
+// Unload compiled binary, unmapped if memory-mapped
+void rini_unload_binary(rini_binary *binary)
+{
+    if (binary->mapped) rini_unmap_file(binary->data, binary->size);
+
+    binary->data = NULL;
+    binary->size = 0;
+    binary->mapped = false;
+}
+
+// Get binary value type for provided key, RINI_VALUE_NONE if not found
+rini_value_type rini_binary_get_value_type(rini_binary binary, const char *key)
+{
+    rini_value value = { 0 };
+    rini_binary_find(binary, false, NULL, key, &value);
+
+    return value.type;
+}
+
+// Get binary value int for provided key, returns 0 if not found or not valid
+int rini_binary_get_value(rini_binary binary, const char *key)
+{
+    int result = 0;
+    rini_value value = { 0 };
+
+    if (rini_binary_find(binary, false, NULL, key, &value)) result = rini_value_to_int(&value);
+
+    return result;
+}
+
+// Get binary value text for provided key, returns NULL if not found
+const char *rini_binary_get_value_text(rini_binary binary, const char *key)
+{
+    const char *text = NULL;
+    rini_value value = { 0 };
+
+    if (rini_binary_find(binary, false, NULL, key, &value)) text = value.text;
+
+    return text;
+}
+
+// Get binary value description for provided key, returns NULL if not found
+const char *rini_binary_get_value_description(rini_binary binary, const char *key)
+{
+    const char *desc = NULL;
+    rini_value value = { 0 };
+
+    if (rini_binary_find(binary, false, NULL, key, &value)) desc = value.desc;
+
+    return desc;
+}
+
+// Get binary value bool for provided key, returns false if not found or not valid
+bool rini_binary_try_get_value_bool(rini_binary binary, const char *key, bool *value)
+{
+    rini_value entry = { 0 };
+
+    return rini_binary_find(binary, false, NULL, key, &entry) && rini_value_try_bool(&entry, value);
+}
+
+// Get binary value int64 for provided key, returns false if not found or not valid
+bool rini_binary_try_get_value_int64(rini_binary binary, const char *key, long long *value)
+{
+    rini_value entry = { 0 };
+
+    return rini_binary_find(binary, false, NULL, key, &entry) && rini_value_try_int64(&entry, value);
+}
+
+// Get binary value uint64 for provided key, returns false if not found or not valid
+bool rini_binary_try_get_value_uint64(rini_binary binary, const char *key, unsigned long long *value)
+{
+    rini_value entry = { 0 };
+
+    return rini_binary_find(binary, false, NULL, key, &entry) && rini_value_try_uint64(&entry, value);
+}
+
+// Get binary value double for provided key, returns false if not found or not valid
+bool rini_binary_try_get_value_double(rini_binary binary, const char *key, double *value)
+{
+    rini_value entry = { 0 };
+
+    return rini_binary_find(binary, false, NULL, key, &entry) && rini_value_try_double(&entry, value);
+}
+
+// Get binary section value type for provided key, RINI_VALUE_NONE if not found
+rini_value_type rini_binary_get_section_value_type(rini_binary binary, const char *section, const char *key)
+{
+    rini_value value = { 0 };
+    rini_binary_find(binary, true, section, key, &value);
+
+    return value.type;
+}
+
+// Get binary section value int for provided key, returns 0 if not found or not valid
+int rini_binary_get_section_value(rini_binary binary, const char *section, const char *key)
+{
+    int result = 0;
+    rini_value value = { 0 };
+
+    if (rini_binary_find(binary, true, section, key, &value)) result = rini_value_to_int(&value);
+
+    return result;
+}
+
+// Get binary section value text for provided key, returns NULL if not found
+const char *rini_binary_get_section_value_text(rini_binary binary, const char *section, const char *key)
+{
+    const char *text = NULL;
+    rini_value value = { 0 };
+
+    if (rini_binary_find(binary, true, section, key, &value)) text = value.text;
+
+    return text;
+}
+
+// Get binary section value bool for provided key, returns false if not found or not valid
+bool rini_binary_try_get_section_value_bool(rini_binary binary, const char *section, const char *key, bool *value)
+{
+    rini_value entry = { 0 };
+
+    return rini_binary_find(binary, true, section, key, &entry) && rini_value_try_bool(&entry, value);
+}
+
+// Get binary section value int64 for provided key, returns false if not found or not valid
+bool rini_binary_try_get_section_value_int64(rini_binary binary, const char *section, const char *key, long long *value)
+{
+    rini_value entry = { 0 };
+
+    return rini_binary_find(binary, true, section, key, &entry) && rini_value_try_int64(&entry, value);
+}
+
+// Get binary section value uint64 for provided key, returns false if not found or not valid
+bool rini_binary_try_get_section_value_uint64(rini_binary binary, const char *section, const char *key, unsigned long long *value)
+{
+    rini_value entry = { 0 };
+
+    return rini_binary_find(binary, true, section, key, &entry) && rini_value_try_uint64(&entry, value);
+}
+
+// Get binary section value double for provided key, returns false if not found or not valid
+bool rini_binary_try_get_section_value_double(rini_binary binary, const char *section, const char *key, double *value)
+{
+    rini_value entry = { 0 };
+
+    return rini_binary_find(binary, true, section, key, &entry) && rini_value_try_double(&entry, value);
+}
+#endif
+
+// Get value for provided key, returns 0 if not found or not valid
+int rini_get_value(rini_data data, const char *key)
+{
+    int value = 0;
+    int position = rini_lookup_key(data, key);
+
+    if (position >= 0) value = rini_value_to_int(&data.values[position]);
+
+    return value;
+}
+
+// Get value for provided key with default value fallback if not found or not valid
+// NOTE: Only integer values are valid, text values starting with numbers are not converted
+int rini_get_value_fallback(rini_data data, const char *key, int fallback)
+{
+    int value = fallback;
+    int position = rini_lookup_key(data, key);
+
+    if (position >= 0) rini_value_try_int(&data.values[position], &value);
+
+    return value;
+}
+
+// Get text for string id
+const char *rini_get_value_text(rini_data data, const char *key)
+{
+    const char *text = NULL;
+    int position = rini_lookup_key(data, key);
+
+    if (position >= 0) text = data.values[position].text;
+
+    return text;
+}
+
+// Get value text for provided key with fallback if not found or not valid
+const char *rini_get_value_text_fallback(rini_data data, const char *key, const char *fallback)
+{
+    const char *text = fallback;
+    int position = rini_lookup_key(data, key);
+
+    if (position >= 0) text = data.values[position].text;
+
+    return text;
+}
+
+// Get value type for provided key, RINI_VALUE_NONE if not found
+rini_value_type rini_get_value_type(rini_data data, const char *key)
+{
+    rini_value_type type = RINI_VALUE_NONE;
+    int position = rini_lookup_key(data, key);
+
+    if (position >= 0) type = data.values[position].type;
+
+    return type;
+}
+
+// Get value int for provided key, returns false if not found or not valid
+// NOTE: Only integer values in int range are valid, value is not modified otherwise
+bool rini_try_get_value(rini_data data, const char *key, int *value)
+{
+    bool result = false;
+    int position = rini_lookup_key(data, key);
+
+    if (position >= 0) result = rini_value_try_int(&data.values[position], value);
+
+    return result;
+}
+
+// Get value bool for provided key, returns false if not found or not valid
+// NOTE: Boolean values (true/false) or integer values 0/1 are valid, value is not modified otherwise
+bool rini_try_get_value_bool(rini_data data, const char *key, bool *value)
+{
+    bool result = false;
+    int position = rini_lookup_key(data, key);
+
+    if (position >= 0) result = rini_value_try_bool(&data.values[position], value);
+
+    return result;
+}
+
+// Get value int64 for provided key, returns false if not found or not valid
+bool rini_try_get_value_int64(rini_data data, const char *key, long long *value)
+{
+    bool result = false;
+    int position = rini_lookup_key(data, key);
+
+    if (position >= 0) result = rini_value_try_int64(&data.values[position], value);
+
+    return result;
+}
+
+// Get value uint64 for provided key, returns false if not found or not valid
+bool rini_try_get_value_uint64(rini_data data, const char *key, unsigned long long *value)
+{
+    bool result = false;
+    int position = rini_lookup_key(data, key);
+
+    if (position >= 0) result = rini_value_try_uint64(&data.values[position], value);
+
+    return result;
+}
+
+// Get value double for provided key, returns false if not found or not valid
+bool rini_try_get_value_double(rini_data data, const char *key, double *value)
+{
+    bool result = false;
+    int position = rini_lookup_key(data, key);
+
+    if (position >= 0) result = rini_value_try_double(&data.values[position], value);
+
+    return result;
+}
+
+// Get value int64 for provided key, returns 0 if not found or not valid
+long long rini_get_value_int64(rini_data data, const char *key)
+{
+    long long value = 0;
+
+    rini_try_get_value_int64(data, key, &value);
+
+    return value;
+}
+
+// Get value uint64 for provided key, returns 0 if not found or not valid
+unsigned long long rini_get_value_uint64(rini_data data, const char *key)
+{
+    unsigned long long value = 0;
+
+    rini_try_get_value_uint64(data, key, &value);
+
+    return value;
+}
+
+// Get value double for provided key, returns 0.0 if not found or not valid
+double rini_get_value_double(rini_data data, const char *key)
+{
+    double value = 0.0;
+
+    rini_try_get_value_double(data, key, &value);
+
+    return value;
+}
+
+// Get description for string id
+const char *rini_get_value_description(rini_data data, const char *key)
+{
+    const char *desc = NULL;
+    int position = rini_lookup_key(data, key);
+
+    if (position >= 0) desc = data.values[position].desc;
+
+    return desc;
+}
+
+// Set comment line
+int rini_set_comment_line(rini_data *data, const char *comment)
+{
+    int result = -1;
+
+    result = rini_set_value_text(data, NULL, NULL, comment);
+
+    return result;
+}
+
+// Set value and description for existing key or create a new entry
+int rini_set_value(rini_data *data, const char *key, int value, const char *desc)
+{
+    int result = -1;
+    char value_text[16] = { 0 };
+
+    rini_int_to_text(value, value_text);
+
+    result = rini_set_value_entry(data, key, value_text, desc, false);
+
+    return result;
+}
+
+// Set value int64 and description for existing key or create a new entry
+int rini_set_value_int64(rini_data *data, const char *key, long long value, const char *desc)
+{
+    int result = -1;
+    char value_text[32] = { 0 };
+
+    rini_int_to_text(value, value_text);
+
+    result = rini_set_value_entry(data, key, value_text, desc, false);
+
+    return result;
+}
+
+// Set value uint64 and description for existing key or create a new entry
+int rini_set_value_uint64(rini_data *data, const char *key, unsigned long long value, const char *desc)
+{
+    int result = -1;
+    char value_text[32] = { 0 };
+
+    rini_uint_to_text(value, value_text);
+
+    result = rini_set_value_entry(data, key, value_text, desc, false);
+
+    return result;
+}
+
+// Set value double and description for existing key or create a new entry
+int rini_set_value_double(rini_data *data, const char *key, double value, const char *desc)
+{
+    int result = -1;
+    char value_text[32] = { 0 };
+
+    rini_double_to_text(value, value_text);
+
+    result = rini_set_value_entry(data, key, value_text, desc, false);
+
+    return result;
+}
+
+// Set value text and description for existing key or create a new entry
+// NOTE: When setting a text value, if id does not exist, a new entry is automatically created
+// in global section, comment lines (NULL key and text) are always added at the end
+int rini_set_value_text(rini_data *data, const char *key, const char *text, const char *desc)
+{
+    int result = -1;
+
+    result = rini_set_value_entry(data, key, text, desc, true);
+
+    return result;
+}
+
+// Set value description for existing key
+// WARNING: Key must exist to add description, if a description exists, it is updated
+int rini_set_value_description(rini_data *data, const char *key, const char *desc)
+{
+    int result = 1;
+    int position = rini_find_key(*data, key);
+
+    if (position >= 0) // Key found
+    {
+        rini_value *value = &data->values[position];
+        rini_set_string(data, &value->desc, &value->desc_len, (desc != NULL)? desc : "");
+        value->is_dirty = true;
+        RINI_STATS_ADD(data->stats, sets, 1);
+        result = 0;
+    }
+
+    return result;
+}
+
+// Get section value for provided key, returns 0 if not found or not valid
+int rini_get_section_value(rini_data data, const char *section, const char *key)
+{
+    int value = 0;
+    int position = rini_lookup_section_key(data, section, key);
+
+    if (position >= 0) value = rini_value_to_int(&data.values[position]);
+
+    return value;
+}
+
+// Get section value text for provided key
+const char *rini_get_section_value_text(rini_data data, const char *section, const char *key)
+{
+    const char *text = NULL;
+    int position = rini_lookup_section_key(data, section, key);
+
+    if (position >= 0) text = data.values[position].text;
+
+    return text;
+}
+
+// Get section value description for provided key
+const char *rini_get_section_value_description(rini_data data, const char *section, const char *key)
+{
+    const char *desc = NULL;
+    int position = rini_lookup_section_key(data, section, key);
+
+    if (position >= 0) desc = data.values[position].desc;
+
+    return desc;
+}
+
+// Get section value for provided key with default value fallback if not found or not valid
+int rini_get_section_value_fallback(rini_data data, const char *section, const char *key, int fallback)
+{
+    int value = fallback;
+    int position = rini_lookup_section_key(data, section, key);
+
+    if (position >= 0) rini_value_try_int(&data.values[position], &value);
+
+    return value;
+}
+
+// Get section value text for provided key with fallback if not found or not valid
+const char *rini_get_section_value_text_fallback(rini_data data, const char *section, const char *key, const char *fallback)
+{
+    const char *text = fallback;
+    int position = rini_lookup_section_key(data, section, key);
+
+    if (position >= 0) text = data.values[position].text;
+
+    return text;
+}
+
+// Get section value type for provided key, RINI_VALUE_NONE if not found
+rini_value_type rini_get_section_value_type(rini_data data, const char *section, const char *key)
+{
+    rini_value_type type = RINI_VALUE_NONE;
+    int position = rini_lookup_section_key(data, section, key);
+
+    if (position >= 0) type = data.values[position].type;
+
+    return type;
+}
+
+// Get section value int for provided key, returns false if not found or not valid
+bool rini_try_get_section_value(rini_data data, const char *section, const char *key, int *value)
+{
+    bool result = false;
+    int position = rini_lookup_section_key(data, section, key);
+
+    if (position >= 0) result = rini_value_try_int(&data.values[position], value);
+
+    return result;
+}
+
+// Get section value bool for provided key, returns false if not found or not valid
+bool rini_try_get_section_value_bool(rini_data data, const char *section, const char *key, bool *value)
+{
+    bool result = false;
+    int position = rini_lookup_section_key(data, section, key);
+
+    if (position >= 0) result = rini_value_try_bool(&data.values[position], value);
+
+    return result;
+}
+
+// Get section value int64 for provided key, returns false if not found or not valid
+bool rini_try_get_section_value_int64(rini_data data, const char *section, const char *key, long long *value)
+{
+    bool result = false;
+    int position = rini_lookup_section_key(data, section, key);
+
+    if (position >= 0) result = rini_value_try_int64(&data.values[position], value);
+
+    return result;
+}
+
+// Get section value uint64 for provided key, returns false if not found or not valid
+bool rini_try_get_section_value_uint64(rini_data data, const char *section, const char *key, unsigned long long *value)
+{
+    bool result = false;
+    int position = rini_lookup_section_key(data, section, key);
+
+    if (position >= 0) result = rini_value_try_uint64(&data.values[position], value);
+
+    return result;
+}
+
+// Get section value double for provided key, returns false if not found or not valid
+bool rini_try_get_section_value_double(rini_data data, const char *section, const char *key, double *value)
+{
+    bool result = false;
+    int position = rini_lookup_section_key(data, section, key);
+
+    if (position >= 0) result = rini_value_try_double(&data.values[position], value);
+
+    return result;
+}
+
+// Set section value and description for existing key or create a new entry
+int rini_set_section_value(rini_data *data, const char *section, const char *key, int value, const char *desc)
+{
+    int result = -1;
+    char value_text[16] = { 0 };
+
+    rini_int_to_text(value, value_text);
+
+    result = rini_set_section_value_entry(data, section, key, value_text, desc, false);
+
+    return result;
+}
+
+// Set section value int64 and description for existing key or create a new entry
+int rini_set_section_value_int64(rini_data *data, const char *section, const char *key, long long value, const char *desc)
+{
+    int result = -1;
+    char value_text[32] = { 0 };
+
+    rini_int_to_text(value, value_text);
+
+    result = rini_set_section_value_entry(data, section, key, value_text, desc, false);
+
+    return result;
+}
+
+// Set section value uint64 and description for existing key or create a new entry
+int rini_set_section_value_uint64(rini_data *data, const char *section, const char *key, unsigned long long value, const char *desc)
+{
+    int result = -1;
+    char value_text[32] = { 0 };
+
+    rini_uint_to_text(value, value_text);
+
+    result = rini_set_section_value_entry(data, section, key, value_text, desc, false);
+
+    return result;
+}
+
+// Set section value double and description for existing key or create a new entry
+int rini_set_section_value_double(rini_data *data, const char *section, const char *key, double value, const char *desc)
+{
+    int result = -1;
+    char value_text[32] = { 0 };
+
+    rini_double_to_text(value, value_text);
+
+    result = rini_set_section_value_entry(data, section, key, value_text, desc, false);
+
+    return result;
+}
+
+// Set section value text and description for existing key or create a new entry
+// NOTE: New values are added after section last value, before trailing comments and empty lines
+int rini_set_section_value_text(rini_data *data, const char *section, const char *key, const char *text, const char *desc)
+{
+    int result = -1;
+
+    result = rini_set_section_value_entry(data, section, key, text, desc, true);
+
+    return result;
+}
+
+// Set section value description for existing key
+// WARNING: Key must exist to add description, if a description exists, it is updated
+int rini_set_section_value_description(rini_data *data, const char *section, const char *key, const char *desc)
+{
+    int result = 1;
+    int position = rini_find_section_key(*data, rini_find_section(*data, section), key);
+
+    if (position >= 0) // Key found
+    {
+        rini_value *value = &data->values[position];
+        rini_set_string(data, &value->desc, &value->desc_len, (desc != NULL)? desc : "");
+        value->is_dirty = true;
+        RINI_STATS_ADD(data->stats, sets, 1);
+        result = 0;
+    }
+
+    return result;
+}
+
+// Get section values (iterator), returns pointer to first value after section line and values count
+// NOTE: Returned values include comments and empty lines (if loaded), NULL returned if section not found
+rini_value *rini_get_section_values(rini_data data, const char *section, unsigned int *count)
+{
+    rini_value *values = NULL;
+    int section_index = rini_find_section(data, section);
+
+    if (count != NULL) *count = 0;
+
+    if (section_index >= 0)
+    {
+        // NOTE: Section line is not part of returned values, global section has no section line
+        unsigned int first = data.sections[section_index].first + ((section_index > 0)? 1 : 0);
+        values = data.values + first;
+        if (count != NULL) *count = data.sections[section_index].first + data.sections[section_index].count - first;
+    }
+
+    return values;
+}
+
+// Load schema fields into config struct, returns fields found count (found with a valid value)
+// NOTE: Every field key is looked up once (keys index probe if available), first key found is used
+// (same as rini_get_value()), fields not found or with a value not valid for field type are not modified (default kept)
+int rini_load_schema(rini_data data, const rini_field *fields, unsigned int field_count, void *config)
+{
+    int result = 0;
+    unsigned char *base = (unsigned char *)config;
+
+    for (unsigned int f = 0; f < field_count; f++)
+    {
+        int position = rini_lookup_key(data, fields[f].key);
+
+        // NOTE: Field is only counted if value is valid for field type (converted)
+        if ((position >= 0) && rini_value_try_field(&data.values[position], fields[f].type, base + fields[f].offset)) result++;
+    }
+
+    return result;
+}
+
+// Get values for many keys at once (batch), returns fallbacks count
+// NOTE: First key found is used (same as rini_get_value()), if keys index is available every key is
+// resolved with one probe, otherwise values are scanned once probing a temporary queries keys table.
+// Output is set to fallback (if provided) for keys not found or with a value not valid for query type
+int rini_get_values(rini_data data, rini_query *queries, unsigned int count)
+{
+    int result = 0;
+
+    for (unsigned int q = 0; q < count; q++) queries[q].found = false;
+
+#if RINI_USE_KEY_HASH_INDEX
+    if (data.index.slots != NULL)
+    {
+        for (unsigned int q = 0; q < count; q++)
+        {
+            int position = rini_lookup_key(data, queries[q].key);
+            if (position >= 0) queries[q].found = rini_value_try_field(&data.values[position], queries[q].type, queries[q].value);
+        }
+    }
+    else
+#endif
+    {
+        // NOTE: Queries keys are hashed into a temporary table (query position + 1), values are scanned once
+        // and every value key probes it, scan cost does not depend on queries count. Matched slots are marked
+        // (probing continues over them), so only first key found is considered, same key queries all matched
+        unsigned int capacity = 16;
+        while ((capacity/2) < count) capacity *= 2;
+
+        unsigned int *slots = (count > 0)? (unsigned int *)RINI_CALLOC(capacity, sizeof(unsigned int)) : NULL;
+        unsigned int mask = capacity - 1;
+        unsigned int pending = 0;
+
+        if (slots != NULL)
+        {
+            for (unsigned int q = 0; q < count; q++)
+            {
+                if (queries[q].key == NULL) continue;
+
+                unsigned int slot = (unsigned int)rini_hash_text(queries[q].key, (unsigned int)strlen(queries[q].key)) & mask;
+                while (slots[slot] != 0) slot = (slot + 1) & mask;
+
+                slots[slot] = q + 1;
+                pending++;
+            }
+
+            for (unsigned int i = 0; (i < data.count) && (pending > 0); i++)
+            {
+                const rini_value *value = &data.values[i];
+
+                // NOTE: Comment lines, empty lines and section lines have no key, never matched
+                if (value->key_len == 0) continue;
+
+                for (unsigned int slot = (unsigned int)rini_hash_text(value->key, value->key_len) & mask; slots[slot] != 0; slot = (slot + 1) & mask)
+                {
+                    if (slots[slot] == 0xFFFFFFFF) continue;    // Query already matched
+
+                    rini_query *query = &queries[slots[slot] - 1];
+
+                    if (strcmp(query->key, value->key) == 0)
+                    {
+                        query->found = rini_value_try_field(value, query->type, query->value);
+                        slots[slot] = 0xFFFFFFFF;
+                        pending--;
+                    }
+                }
+            }
+
+            RINI_FREE(slots);
+            RINI_STATS_ADD(data.stats, lookups, count);
+            RINI_STATS_ADD(data.stats, hits, count - pending);
+            RINI_STATS_ADD(data.stats, misses, pending);
+        }
+        else if (count > 0)
+        {
+            // Queries table can not be allocated, keys looked up one by one
+            RINI_LOG("WARNING: Batch queries table can not be allocated, keys looked up one by one\n");
+
+            for (unsigned int q = 0; q < count; q++)
+            {
+                int position = rini_lookup_key(data, queries[q].key);
+                if (position >= 0) queries[q].found = rini_value_try_field(&data.values[position], queries[q].type, queries[q].value);
+            }
+        }
+    }
+
+    for (unsigned int q = 0; q < count; q++)
+    {
+        if (!queries[q].found)
+        {
+            if ((queries[q].fallback != NULL) && (queries[q].value != NULL)) memcpy(queries[q].value, queries[q].fallback, rini_field_size(queries[q].type));
+            result++;
+        }
+    }
+
+    return result;
+}
+
+// Get handle for provided key, position -1 if not found
+// NOTE: Key is looked-up once, handle gives direct value access while data values are not moved
+rini_handle rini_get_handle(rini_data data, const char *key)
+{
+    rini_handle handle = { 0 };
+
+    handle.position = rini_lookup_key(data, key);
+    handle.generation = data.generation;
+
+    return handle;
+}
+
+// Get handle for provided key in section, position -1 if not found
+rini_handle rini_get_section_handle(rini_data data, const char *section, const char *key)
+{
+    rini_handle handle = { 0 };
+
+    handle.position = rini_lookup_section_key(data, section, key);
+    handle.generation = data.generation;
+
+    return handle;
+}
+
+// Check handle is valid: key found and data values not moved or removed since resolved
+bool rini_handle_is_valid(rini_data data, rini_handle handle)
+{
+    bool valid = (handle.position >= 0) && ((unsigned int)handle.position < data.count) && (handle.generation == data.generation);
+
+    return valid;
+}
+
+// Get handle value type, RINI_VALUE_NONE if not valid
+rini_value_type rini_handle_get_value_type(rini_data data, rini_handle handle)
+{
+    rini_value_type type = RINI_VALUE_NONE;
+
+    if (rini_handle_is_valid(data, handle)) type = data.values[handle.position].type;
+
+    return type;
+}
+
+// Get handle value, returns 0 if not valid
+int rini_handle_get_value(rini_data data, rini_handle handle)
+{
+    int value = 0;
+
+    if (rini_handle_is_valid(data, handle)) value = rini_value_to_int(&data.values[handle.position]);
+
+    return value;
+}
+
+// Get handle value text, returns NULL if not valid
+const char *rini_handle_get_value_text(rini_data data, rini_handle handle)
+{
+    const char *text = NULL;
+
+    if (rini_handle_is_valid(data, handle)) text = data.values[handle.position].text;
+
+    return text;
+}
+
+// Get handle value bool, returns false if handle or value not valid
+bool rini_handle_try_get_value_bool(rini_data data, rini_handle handle, bool *value)
+{
+    bool result = false;
+
+    if (rini_handle_is_valid(data, handle)) result = rini_value_try_bool(&data.values[handle.position], value);
+
+    return result;
+}
+
+// Get handle value int64, returns false if handle or value not valid
+bool rini_handle_try_get_value_int64(rini_data data, rini_handle handle, long long *value)
+{
+    bool result = false;
+
+    if (rini_handle_is_valid(data, handle)) result = rini_value_try_int64(&data.values[handle.position], value);
+
+    return result;
+}
+
+// Get handle value uint64, returns false if handle or value not valid
+bool rini_handle_try_get_value_uint64(rini_data data, rini_handle handle, unsigned long long *value)
+{
+    bool result = false;
+
+    if (rini_handle_is_valid(data, handle)) result = rini_value_try_uint64(&data.values[handle.position], value);
+
+    return result;
+}
+
+// Get handle value double, returns false if handle or value not valid
+bool rini_handle_try_get_value_double(rini_data data, rini_handle handle, double *value)
+{
+    bool result = false;
+
+    if (rini_handle_is_valid(data, handle)) result = rini_value_try_double(&data.values[handle.position], value);
+
+    return result;
+}
+
+// Set handle value and description, returns -1 if handle not valid
+int rini_handle_set_value(rini_data *data, rini_handle handle, int value, const char *desc)
+{
+    int result = -1;
+    char value_text[16] = { 0 };
+
+    rini_int_to_text(value, value_text);
+
+    result = rini_handle_set_value_text(data, handle, value_text, desc);
+    if (result == 0) data->values[handle.position].is_text = false;
+
+    return result;
+}
+
+// Set handle value int64 and description, returns -1 if handle not valid
+int rini_handle_set_value_int64(rini_data *data, rini_handle handle, long long value, const char *desc)
+{
+    int result = -1;
+    char value_text[32] = { 0 };
+
+    rini_int_to_text(value, value_text);
+
+    result = rini_handle_set_value_text(data, handle, value_text, desc);
+    if (result == 0) data->values[handle.position].is_text = false;
+
+    return result;
+}
+
+// Set handle value uint64 and description, returns -1 if handle not valid
+int rini_handle_set_value_uint64(rini_data *data, rini_handle handle, unsigned long long value, const char *desc)
+{
+    int result = -1;
+    char value_text[32] = { 0 };
+
+    rini_uint_to_text(value, value_text);
+
+    result = rini_handle_set_value_text(data, handle, value_text, desc);
+    if (result == 0) data->values[handle.position].is_text = false;
+
+    return result;
+}
+
+// Set handle value double and description, returns -1 if handle not valid
+int rini_handle_set_value_double(rini_data *data, rini_handle handle, double value, const char *desc)
+{
+    int result = -1;
+    char value_text[32] = { 0 };
+
+    rini_double_to_text(value, value_text);
+
+    result = rini_handle_set_value_text(data, handle, value_text, desc);
+    if (result == 0) data->values[handle.position].is_text = false;
+
+    return result;
+}
+
+// Set handle value text and description, returns -1 if handle not valid
+// NOTE: No new entry is created, value is never moved (handle keeps valid)
+int rini_handle_set_value_text(rini_data *data, rini_handle handle, const char *text, const char *desc)
+{
+    int result = -1;
+
+    if (rini_handle_is_valid(*data, handle))
+    {
+        rini_update_value(data, &data->values[handle.position], text, desc);
+        result = 0;
+    }
+
+    return result;
+}
+
+// Intern key, returns key id or -1 on failure
+// NOTE: Key is copied into intern table only if not already interned, key id never changes
+int rini_intern_key(rini_intern *intern, const char *key)
+{
+    int key_id = rini_intern_find(*intern, key);
+
+    if ((key_id < 0) && (key != NULL) && (key[0] != '\0') && ((intern->count < intern->capacity) || rini_intern_grow(intern)))
+    {
+        unsigned int key_len = (unsigned int)strlen(key);
+
+        if (intern->strings.block_size == 0) intern->strings.block_size = RINI_STRING_BLOCK_MAX_SIZE;
+        char *copy = (char *)rini_alloc(&intern->strings, key_len + 1);
+
+        if (copy != NULL)
+        {
+            memcpy(copy, key, key_len + 1);
+
+            key_id = (int)intern->count;
+            intern->keys[key_id] = copy;
+            intern->count++;
+            rini_intern_insert(intern, (unsigned int)key_id);
+        }
+    }
+
+    return key_id;
+}
+
+// Find interned key id, returns -1 if not interned
+int rini_intern_find(rini_intern intern, const char *key)
+{
+    int key_id = -1;
+
+    if ((key != NULL) && (intern.slots != NULL))
+    {
+        unsigned int mask = intern.slot_capacity - 1;
+        unsigned int slot = (unsigned int)rini_hash_text(key, (unsigned int)strlen(key)) & mask;
+
+        // Linear probing until key is found or an empty slot is reached
+        while (intern.slots[slot] != 0)
+        {
+            const char *interned = intern.keys[intern.slots[slot] - 1];
+
+            if ((key == interned) || (strcmp(key, interned) == 0)) // Key found
+            {
+                key_id = (int)intern.slots[slot] - 1;
+                break;
+            }
+
+            slot = (slot + 1) & mask;
+        }
+    }
+
+    return key_id;
+}
+
+// Get interned key for key id, returns NULL if not valid
+// NOTE: Interned key can be used with any data getter, interned data keys are found by pointer
+const char *rini_intern_get_key(rini_intern intern, int key_id)
+{
+    const char *key = NULL;
+
+    if ((key_id >= 0) && ((unsigned int)key_id < intern.count)) key = intern.keys[key_id];
+
+    return key;
+}
+
+// Unload intern table, all keys freed
+// WARNING: Data keys interned are no longer valid
+void rini_unload_intern(rini_intern *intern)
+{
+    RINI_FREE(intern->keys);
+    RINI_FREE(intern->slots);
+    rini_unload_arena(&intern->strings);
+
+    memset(intern, 0, sizeof(rini_intern));
+}
+
+// Intern data keys, returns 0 on success
+// NOTE: Data keys point to intern table keys (shared by all data interned), data keys positions are
+// mapped by key id (first key found, same as rini_get_value()), so a key id resolved once is valid for any data.
+// Loaded text buffer is not released (values text still point into it), keys added later by setters are
+// interned too, data must be unloaded before intern table
+int rini_intern_data(rini_data *data, rini_intern *intern)
+{
+    int result = 0;
+
+    for (unsigned int i = 0; (i < data->count) && (result == 0); i++)
+    {
+        rini_value *value = &data->values[i];
+
+        // NOTE: Comment lines, empty lines and section lines have no key, never interned
+        if (value->key_len > 0)
+        {
+            int key_id = rini_intern_key(intern, value->key);
+
+            if (key_id >= 0) value->key = intern->keys[key_id];
+            else result = -1;
+        }
+    }
+
+    if (result == 0)
+    {
+        data->intern = intern;
+        if (!rini_intern_map(data)) result = -1;
+    }
+
+    return result;
+}
+
+// Get handle for interned key id, position -1 if not found
+// NOTE: No key lookup, key id is mapped to value position directly
+rini_handle rini_get_interned_handle(rini_data data, int key_id)
+{
+    rini_handle handle = { 0 };
+
+    handle.position = -1;
+    handle.generation = data.generation;
+
+    if ((key_id >= 0) && ((unsigned int)key_id < data.key_position_count)) handle.position = (int)data.key_positions[key_id] - 1;
+
+    return handle;
+}
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Declaration
+//----------------------------------------------------------------------------------
+// Load text file into a buffer ('\0' ended), file is read at once
+static char *rini_load_file_text(const char *file_name, unsigned int *size, rini_arena *arena)
+{
+    char *text = NULL;
+    *size = 0;
+
+    if (file_name != NULL)
+    {
+        // NOTE: File is read in binary mode, line endings are processed by parser
+        FILE *rini_file = fopen(file_name, "rb");
+
+        if (rini_file != NULL)
+        {
+            fseek(rini_file, 0, SEEK_END);
+            long file_size = ftell(rini_file);
+            fseek(rini_file, 0, SEEK_SET);
+
+            if (file_size > 0)
+            {
+                // NOTE: Text is padded for blocks scanning, see rini_find_chars()
+                text = ((unsigned long long)file_size < (0xFFFFFFFFull - 1 - RINI_SCAN_PADDING))? (char *)rini_alloc(arena, (unsigned int)file_size + 1 + RINI_SCAN_PADDING) : NULL;
+
+                if (text != NULL)
+                {
+                    unsigned int count = (unsigned int)fread(text, 1, (size_t)file_size, rini_file);
+                    memset(text + count, 0, 1 + RINI_SCAN_PADDING);
+                    *size = count;
+                }
+            }
+
+            fclose(rini_file);
+        }
+    }
+
+    return text;
+}
+
+// Save text buffer into file at once, returns 0 on success
+// NOTE: File is flushed to disk if sync requested, so data survives a system crash,
+// binary data is written with no line endings conversion
+static int rini_save_file_text(const char *file_name, const char *text, unsigned int size, bool sync, bool binary)
+{
+    int result = -1;
+    FILE *rini_file = fopen(file_name, binary? "wb" : "wt");
+
+    if (rini_file != NULL)
+    {
+        if ((fwrite(text, 1, size, rini_file) == size) && (fflush(rini_file) == 0)) result = 0;
+
+#if RINI_USE_SAVE_FILE_SYNC
+    #if defined(_WIN32)
+        if ((result == 0) && sync && (_commit(_fileno(rini_file)) != 0)) result = -1;
+    #else
+        if ((result == 0) && sync && (fsync(fileno(rini_file)) != 0)) result = -1;
+    #endif
+#else
+        (void)sync;
+#endif
+        if (fclose(rini_file) != 0) result = -1;
+    }
+
+    return result;
+}
+
+// Replace file with new file (atomic rename), returns 0 on success
+// NOTE: Containing directory is flushed to disk if file sync enabled, making the rename durable
+static int rini_replace_file(const char *file_name, const char *new_file_name)
+{
+    int result = -1;
+
+#if defined(_WIN32)
+    unsigned long flags = RINI_MOVEFILE_REPLACE_EXISTING;
+    #if RINI_USE_SAVE_FILE_SYNC
+    flags |= RINI_MOVEFILE_WRITE_THROUGH;
+    #endif
+    if (MoveFileExA(new_file_name, file_name, flags) != 0) result = 0;
+#else
+    if (rename(new_file_name, file_name) == 0) result = 0;
+
+    #if RINI_USE_SAVE_FILE_SYNC
+    if (result == 0)
+    {
+        // Get containing directory from file name, current directory if no path provided
+        const char *separator = strrchr(file_name, '/');
+        unsigned int dir_len = (separator != NULL)? (unsigned int)(separator - file_name) : 0;
+        char *dir_name = (char *)RINI_MALLOC(dir_len + 2);
+
+        if (dir_name != NULL)
+        {
+            if (separator == NULL) dir_name[dir_len++] = '.';
+            else if (dir_len == 0) dir_name[dir_len++] = '/';
+            else memcpy(dir_name, file_name, dir_len);
+            dir_name[dir_len] = '\0';
+
+            int dir = open(dir_name, O_RDONLY);
+
+            if (dir >= 0)
+            {
+                fsync(dir);
+                close(dir);
+            }
+
+            RINI_FREE(dir_name);
+        }
+    }
+    #endif
+#endif
+
+    return result;
+}
+
+// Save text buffer into a temporary file (same directory) replacing file once completely written, returns 0 on success
+// NOTE: Original file is kept if saving fails, temporary file is removed
+static int rini_save_file_atomic(const char *file_name, const char *text, unsigned int size)
+{
+    int result = -1;
+    unsigned int name_len = (unsigned int)strlen(file_name);
+    char *temp_file_name = (char *)RINI_MALLOC(name_len + sizeof(RINI_SAVE_TEMP_FILE_EXT));
+
+    if (temp_file_name != NULL)
+    {
+        memcpy(temp_file_name, file_name, name_len);
+        memcpy(temp_file_name + name_len, RINI_SAVE_TEMP_FILE_EXT, sizeof(RINI_SAVE_TEMP_FILE_EXT));
+
+        if (rini_save_file_text(temp_file_name, text, size, RINI_USE_SAVE_FILE_SYNC, false) == 0) result = rini_replace_file(file_name, temp_file_name);
+        if (result != 0) remove(temp_file_name);
+
+        RINI_FREE(temp_file_name);
+    }
+
+    return result;
+}
+
+// Save data to file as new source file (lines spans updated), returns 0 on success
+// NOTE: File is written in binary mode, lines offsets must match saved text
+static int rini_save_source(rini_data *data, const char *file_name)
+{
+    int result = -1;
+    unsigned int size = 0;
+    char *text = rini_save_text(*data, &size);
+
+    if (text != NULL)
+    {
+        FILE *rini_file = fopen(file_name, "wb");
+
+        if (rini_file != NULL)
+        {
+            if (fwrite(text, 1, size, rini_file) == size) result = 0;
+            if (fclose(rini_file) != 0) result = -1;
+        }
+
+        if (result == 0) data->source_hash = rini_hash_text(text, size);
+
+        RINI_FREE(text);
+    }
+
+    if (result == 0)
+    {
+        unsigned int offset = 0;
+
+        for (unsigned int i = 0; i < data->count; i++)
+        {
+            rini_value *value = &data->values[i];
+            unsigned int len = rini_write_value(value, NULL, 0, 0);
+
+            value->src_offset = offset;
+            value->src_size = len - 1;
+            value->in_source = true;
+            value->is_dirty = false;
+
+            offset += len;
+        }
+
+        data->source_size = size;
+    }
+
+    return result;
+}
+
+// Write patched source text from first changed value, returns text length
+// NOTE: Source text (src) starts at start offset in source file, runs until source end,
+// lines spans are updated to patched text if buffer provided (otherwise text is just measured)
+static unsigned int rini_patch_text(rini_data *data, unsigned int first, const char *src, unsigned int start, char *buffer, unsigned int size)
+{
+    unsigned int offset = 0;            // Patched text offset (relative to start)
+    unsigned int pos = start;           // Source position copied up to
+    unsigned int line_end = start;      // Source position after last line in source (including line ending)
+    bool line_ended = true;             // Last line in source has line ending
+    bool update = (buffer != NULL);
+
+    // First value is new, it goes after previous line, including its line ending
+    if (!data->values[first].in_source && (first > 0))
+    {
+        if ((line_end < data->source_size) && (src[line_end - start] == '\r')) line_end++;
+        if ((line_end < data->source_size) && (src[line_end - start] == '\n')) line_end++;
+        line_ended = (line_end > start);
+    }
+
+    for (unsigned int i = first; i < data->count; i++)
+    {
+        rini_value *value = &data->values[i];
+
+        if (value->in_source)
+        {
+            unsigned int src_offset = value->src_offset;
+            unsigned int src_end = value->src_offset + value->src_size;
+
+            line_end = src_end;
+            if ((line_end < data->source_size) && (src[line_end - start] == '\r')) line_end++;
+            if ((line_end < data->source_size) && (src[line_end - start] == '\n')) line_end++;
+            line_ended = (line_end > src_end);
+
+            // Text between copied position and line is kept, line position moved accordingly
+            if (value->is_dirty)
+            {
+                offset += rini_write_text(buffer, size, offset, src + (pos - start), src_offset - pos);
+                pos = src_end;
+
+                // NOTE: Line ending not written, original one is kept
+                unsigned int len = rini_write_value(value, buffer, size, offset) - 1;
+
+                if (update)
+                {
+                    value->src_offset = start + offset;
+                    value->src_size = len;
+                    value->is_dirty = false;
+                }
+
+                offset += len;
+            }
+            else if (update) value->src_offset = start + offset + (src_offset - pos);
+        }
+        else
+        {
+            // New line is inserted after last line in source (or last inserted line)
+            if (line_end > pos)
+            {
+                offset += rini_write_text(buffer, size, offset, src + (pos - start), line_end - pos);
+                pos = line_end;
+            }
+
+            if (!line_ended)
+            {
+                offset += rini_write_chars(buffer, size, offset, '\n', 1);
+                line_ended = true;
+            }
+
+            unsigned int len = rini_write_value(value, buffer, size, offset);
+
+            if (update)
+            {
+                value->src_offset = start + offset;
+                value->src_size = len - 1;
+                value->in_source = true;
+                value->is_dirty = false;
+            }
+
+            offset += len;
+        }
+    }
+
+    // Text after last patched line is kept
+    offset += rini_write_text(buffer, size, offset, src + (pos - start), data->source_size - pos);
+
+    return offset;
+}
+
+// Load data from text buffer, buffer ownership is moved to returned data
+// NOTE: Buffer is parsed in a single pass and values point into it, no strings are copied
+// WARNING: Buffer requires RINI_SCAN_PADDING bytes after text end ('\0' ended), see rini_find_chars()
+static rini_data rini_load_buffer(char *buffer, unsigned int size, bool full, rini_arena *arena)
+{
+    rini_data data = { 0 };
+    data.arena = arena;
+
+    // NOTE: Arena memory is not reused when values grow, values are reserved once for all buffer lines
+    if ((arena != NULL) && (buffer != NULL))
+    {
+        unsigned int capacity = 1;
+        for (const char *line = (const char *)memchr(buffer, '\n', size); line != NULL; line = (const char *)memchr(line + 1, '\n', buffer + size - line - 1)) capacity++;
+#if (RINI_MAX_VALUE_CAPACITY > 0)
+        if (capacity > RINI_MAX_VALUE_CAPACITY) capacity = RINI_MAX_VALUE_CAPACITY;
+#endif
+        data.values = (rini_value *)rini_alloc(arena, capacity*sizeof(rini_value));
+        if (data.values != NULL) data.capacity = capacity;
+    }
+
+    // Init data to initial capacity, it grows as required while parsing
+    if (data.values == NULL) rini_grow_values(&data);
+    data.buffer = buffer;
+
+#if defined(RINI_SUPPORT_STATS)
+    double start_time = rini_trace_begin("parse");
+
+    bool complete = true;
+    if ((buffer != NULL) && (data.values != NULL)) complete = rini_read_lines(&data, buffer, buffer + size, full);
+
+    double parse_time = rini_trace_end("parse", size, start_time);
+
+    start_time = rini_trace_begin("index");
+#else
+    if ((buffer != NULL) && (data.values != NULL)) rini_read_lines(&data, buffer, buffer + size, full);
+#endif
+
+    rini_load_sections(&data);
+
+#if defined(RINI_SUPPORT_STATS)
+    double index_time = rini_trace_end("index", data.count, start_time);
+
+    if (data.stats != NULL)
+    {
+        data.stats->bytes_read += size;
+        data.stats->parse_time = parse_time;
+        data.stats->index_time = index_time;
+        if (!complete) data.stats->truncations++;
+    }
+#endif
+
+    return data;
+}
+
+// Read lines into data values (appended), returns false if values capacity can not be increased
+// NOTE: Lines are tokenized in-place, lines spans are relative to data buffer,
+// no sections or keys index are created, see rini_load_sections()
+static bool rini_read_lines(rini_data *data, char *line, char *end, bool full)
+{
+    bool result = true;
+
+    while (line < end)
+    {
+        // WARNING: No more values can be stored than its max capacity
+        if ((data->count == data->capacity) && !rini_grow_values(data))
+        {
+            RINI_LOG("WARNING: Values capacity can not be increased, increase RINI_MAX_VALUE_CAPACITY\n");
+            result = false;
+            break;
+        }
+
+        char *line_end = (char *)memchr(line, '\n', end - line);
+        if (line_end == NULL) line_end = end;
+        char *next_line = (line_end < end)? line_end + 1 : end;
+
+        // Remove carriage return in case of Windows line endings
+        if ((line_end > line) && (line_end[-1] == '\r')) line_end--;
+
+        rini_value *value = &data->values[data->count];
+        memset(value, 0, sizeof(rini_value));
+
+        if (rini_read_line(line, line_end, value, full))
+        {
+            // Keep line span in source, required to patch source file
+            value->src_offset = (unsigned int)(line - data->buffer);
+            value->src_size = (unsigned int)(line_end - line);
+            value->in_source = true;
+
+            // Resolve value type once, getters do not parse text
+            if (value->key_len > 0) rini_resolve_value(value);
+
+            data->count++;
+        }
+
+        line = next_line;
+    }
+
+    return result;
+}
+
+// Load sections and keys indexes for data values
+// NOTE: Every section line starts a new section, owning next values
+static void rini_load_sections(rini_data *data)
+{
+#if defined(RINI_SUPPORT_STATS)
+    data->stats = (rini_stats *)rini_alloc(data->arena, sizeof(rini_stats));
+    if (data->stats != NULL) memset(data->stats, 0, sizeof(rini_stats));
+#endif
+
+    // Global section, owning values before first section line
+    if (rini_add_section(data, NULL) == 0) data->sections[0].first = 0;
+
+    for (unsigned int i = 0; (i < data->count) && (data->section_count > 0); i++)
+    {
+        if (data->values[i].is_section && ((data->section_count < data->section_capacity) || rini_grow_sections(data)))
+        {
+            rini_section *section = &data->sections[data->section_count];
+            memset(section, 0, sizeof(rini_section));
+            section->name = data->values[i].text;
+            section->first = i;
+            data->section_count++;
+        }
+
+        data->sections[data->section_count - 1].count++;
+    }
+
+#if RINI_USE_KEY_HASH_INDEX
+    rini_index_build(&data->index, data->values, data->count, data->arena);
+
+    for (unsigned int i = 0; i < data->section_count; i++)
+    {
+        rini_section *section = &data->sections[i];
+        rini_index_build(&section->index, data->values + section->first, section->count, data->arena);
+    }
+#endif
+}
+
+#if defined(RINI_SUPPORT_PARALLEL_LOAD)
+// Get available CPU cores count
+static unsigned int rini_get_cpu_count(void)
+{
+    unsigned int count = 1;
+
+#if defined(_WIN32)
+    count = (unsigned int)GetActiveProcessorCount(0xFFFF); // ALL_PROCESSOR_GROUPS
+#else
+    long cores = sysconf(_SC_NPROCESSORS_ONLN);
+    if (cores > 0) count = (unsigned int)cores;
+#endif
+
+    return (count > 0)? count : 1;
+}
+
+// Read chunk lines into chunk values (thread function)
+// NOTE: Only chunk values are modified, text is tokenized only in chunk range
+#if defined(_WIN32)
+static unsigned __stdcall rini_read_chunk(void *chunk)
+#else
+static void *rini_read_chunk(void *chunk)
+#endif
+{
+    rini_chunk *lines = (rini_chunk *)chunk;
+
+    lines->result = true;
+    if (lines->end > lines->start) lines->result = rini_read_lines(&lines->data, lines->start, lines->end, false);
+
+    return 0;
+}
+#endif
+
+// Read value from a text line (key-value-description, comment or empty line)
+// NOTE: Line is tokenized in-place, '\0' placed after key, text and description,
+// returns false if line is skipped (comments and empty lines, if not full loading)
+static bool rini_read_line(char *line, char *end, rini_value *value, bool full)
+{
+    bool valid = false;
+    char *ptr = line;
+
+    // Expected line structure:
+    // [key][spaces?][delimiter?][spaces?][quot-mark?][textValue][quot-mark?][spaces?][[;][#]description?]
+    // NOTE: Processing requires skipping spaces, checking for delimiter (if required), skipping more spaces, and get text value
+
+    while ((ptr < end) && ((*ptr == ' ') || (*ptr == '\t'))) ptr++; // Skip line starting spaces
+
+    if ((ptr == end) || (*ptr == '\0')) // Empty line
+    {
+        if (full)
+        {
+            // Set entry as empty line: NULL, NULL, NULL
+            *line = '\0';
+            value->key = line;
+            value->text = line;
+            value->desc = line;
+            valid = true;
+        }
+    }
+    else if (*ptr == RINI_LINE_COMMENT_DELIMITER) // Comment line
+    {
+        if (full)
+        {
+            ptr++; // Skip comment delimiter
+            *end = '\0';
+            value->key = end;
+            value->text = end;
+
+            if (ptr == end)
+            {
+                // Set entry as empty comment: NULL, NULL, " "
+                // NOTE: Comment delimiter is replaced by space, line is '\0' ended after it
+                ptr[-1] = ' ';
+                value->desc = ptr - 1;
+                value->desc_len = 1;
+            }
+            else
+            {
+                // Set entry as comment: NULL, NULL, "comment"
+                // WARNING: In case of comment line, everything after delimiter is read (including spaces)
+                value->desc = ptr;
+                value->desc_len = (unsigned int)(end - ptr);
+            }
+
+            valid = true;
+        }
+    }
+    else if (*ptr == RINI_LINE_SECTION_DELIMITER) // Section line
+    {
+        // Expected section line structure:
+        // [section-delimiter][spaces?][name][spaces?][']'][spaces?][[#]description?]
+        ptr++; // Skip section delimiter
+        while ((ptr < end) && ((*ptr == ' ') || (*ptr == '\t'))) ptr++;
+
+        char *name = ptr;
+        ptr = rini_find_chars(ptr, end, ']', ']', ']');
+        char *name_end = ptr;
+        while ((name_end > name) && ((name_end[-1] == ' ') || (name_end[-1] == '\t'))) name_end--;
+
+        char *desc = end;
+#if defined(RINI_DESCRIPTION_DELIMITER)
+        ptr = rini_find_chars(ptr, end, RINI_DESCRIPTION_DELIMITER, RINI_DESCRIPTION_DELIMITER, RINI_DESCRIPTION_DELIMITER);
+
+        if (ptr < end)
+        {
+            desc = ptr + 1; // Skip delimiter and following spaces
+            while ((desc < end) && ((*desc == ' ') || (*desc == '\t'))) desc++;
+        }
+#endif
+        // Set entry as section: NULL, "name", "description"
+        value->key = end;
+        value->text = name;
+        value->text_len = (unsigned int)(name_end - name);
+        value->desc = desc;
+        value->desc_len = (unsigned int)(end - desc);
+        value->is_section = true;
+
+        *name_end = '\0';
+        *end = '\0';
+
+        valid = true;
+    }
+    else
+    {
+        char *key = ptr;
+        ptr = rini_find_chars(ptr, end, ' ', '\t', RINI_VALUE_DELIMITER); // Skip key identifier
+        char *key_end = ptr;
+
+        while ((ptr < end) && ((*ptr == ' ') || (*ptr == '\t'))) ptr++; // Skip line spaces before text value or delimiter
+
+#if defined(RINI_VALUE_DELIMITER)
+        if ((ptr < end) && (*ptr == RINI_VALUE_DELIMITER))
+        {
+            ptr++; // Skip delimiter
+
+            while ((ptr < end) && ((*ptr == ' ') || (*ptr == '\t'))) ptr++; // Skip line spaces before text value
+        }
+#endif
+        // Now ptr should be pointing to the start of value
+        char *text = ptr;
+        char *text_end = NULL;
+        char *desc = end;
+
+#if RINI_USE_TEXT_QUOTATION_MARKS
+        // Remove quotation-marks from text (if being used)
+        if ((ptr < end) && (*ptr == RINI_VALUE_QUOTATION_MARKS))
+        {
+            char *quote_end = rini_find_chars(ptr + 1, end, RINI_VALUE_QUOTATION_MARKS, RINI_VALUE_QUOTATION_MARKS, RINI_VALUE_QUOTATION_MARKS);
+
+            text = ptr + 1;
+
+            // NOTE: If ending quotation-mark not found, text is processed as not quoted
+            if (quote_end < end)
+            {
+                text_end = quote_end;
+                ptr = quote_end + 1;
+            }
+
+            value->is_text = true;
+        }
+#endif
+
+#if defined(RINI_DESCRIPTION_DELIMITER)
+        // Scan text looking for text-value description (if used)
+        ptr = rini_find_chars(ptr, end, RINI_DESCRIPTION_DELIMITER, RINI_DESCRIPTION_DELIMITER, RINI_DESCRIPTION_DELIMITER);
+
+        if (ptr < end)
+        {
+            desc = ptr + 1; // Skip delimiter and following spaces
+            while ((desc < end) && ((*desc == ' ') || (*desc == '\t'))) desc++;
+        }
+#else
+        ptr = end;
+#endif
+
+        if (text_end == NULL)
+        {
+            // Text-value ends at description delimiter or end of line, trailing spaces removed
+            text_end = ptr;
+            while ((text_end > text) && ((text_end[-1] == ' ') || (text_end[-1] == '\t'))) text_end--;
+        }
+
+        // Set values pointing to line tokens
+        // NOTE: Tokens are '\0' ended once all positions have been scanned
+        value->key = key;
+        value->key_len = (unsigned int)(key_end - key);
+        value->text = text;
+        value->text_len = (unsigned int)(text_end - text);
+        value->desc = desc;
+        value->desc_len = (unsigned int)(end - desc);
+
+        *key_end = '\0';
+        *text_end = '\0';
+        *end = '\0';
+
+        valid = true;
+    }
+
+    return valid;
+}
+
+// Read line and send it to event callback, returns callback result
+// NOTE: Line is read in full mode (comments and empty lines included), value type is resolved
+static int rini_read_event(char *line, char *end, rini_event_callback callback, void *user_data)
+{
+    int result = 0;
+    rini_value value = { 0 };
+
+    if (rini_read_line(line, end, &value, true))
+    {
+        rini_event_type type = RINI_EVENT_VALUE;
+
+        if (value.is_section) type = RINI_EVENT_SECTION;
+        else if (value.key_len == 0) type = (value.desc_len > 0)? RINI_EVENT_COMMENT : RINI_EVENT_EMPTY;
+        else rini_resolve_value(&value);
+
+        result = callback(type, &value, user_data);
+    }
+
+    return result;
+}
+
+// Read callback for FILE* streams
+static int rini_read_file_stream(void *reader, char *buffer, unsigned int size)
+{
+    FILE *file = (FILE *)reader;
+    int bytes = (int)fread(buffer, 1, size, file);
+
+    if ((bytes == 0) && ferror(file)) bytes = -1;
+
+    return bytes;
+}
+
+// Read callback for file descriptors
+static int rini_read_fd_stream(void *reader, char *buffer, unsigned int size)
+{
+    int fd = *(int *)reader;
+
+#if defined(_WIN32)
+    int bytes = _read(fd, buffer, size);
+#else
+    int bytes = (int)read(fd, buffer, size);
+#endif
+
+    return bytes;
+}
+
+// Compare data keys with other data keys into changes list, returns changes count, -1 on error
+// NOTE: Added and modified keys in other order, then removed keys, strings are copied into changes list
+static int rini_diff_keys(rini_data data, rini_data other, bool descriptions, rini_change_list *changes)
+{
+    int result = -1;
+    unsigned int strings_size = 0;
+
+    memset(changes, 0, sizeof(rini_change_list));
+
+    // Measure changes count and strings size, changes are added once allocated
+    rini_compare_keys(other, data, RINI_CHANGE_ADDED, descriptions, changes, &strings_size);
+    rini_compare_keys(data, other, RINI_CHANGE_REMOVED, descriptions, changes, &strings_size);
+
+    if (changes->count > 0)
+    {
+        changes->changes = (rini_change *)RINI_MALLOC(changes->count*sizeof(rini_change));
+        changes->strings = (char *)RINI_MALLOC(strings_size);
+
+        if ((changes->changes != NULL) && (changes->strings != NULL))
+        {
+            changes->count = 0;
+            strings_size = 0;
+            rini_compare_keys(other, data, RINI_CHANGE_ADDED, descriptions, changes, &strings_size);
+            rini_compare_keys(data, other, RINI_CHANGE_REMOVED, descriptions, changes, &strings_size);
+            result = (int)changes->count;
+        }
+        else
+        {
+            RINI_LOG("WARNING: Changes list can not be allocated\n");
+            rini_unload_changes(changes);
+        }
+    }
+    else result = 0;
+
+    return result;
+}
+
+// Compare data keys with other data keys, changes added to changes list
+// NOTE: Keys are compared per section, only first key is considered in case of duplicates (same as getters),
+// keys not found in other data are added with provided type (added/removed), keys with different text as modified
+// and keys with different description (if requested) as description modified
+static void rini_compare_keys(rini_data data, rini_data other, rini_change_type type, bool descriptions, rini_change_list *changes, unsigned int *strings_size)
+{
+    for (unsigned int s = 0; s < data.section_count; s++)
+    {
+        const rini_section *section = &data.sections[s];
+        int other_section = rini_find_section(other, section->name);
+
+        for (unsigned int i = section->first; i < (section->first + section->count); i++)
+        {
+            const rini_value *value = &data.values[i];
+
+            // Skip comments, section lines and duplicate keys
+            if ((value->key_len == 0) || (rini_find_section_key(data, (int)s, value->key) != (int)i)) continue;
+
+            int position = rini_find_section_key(other, other_section, value->key);
+
+            if (position < 0) rini_add_change(changes, type, section->name, value->key, strings_size);
+            else if (type != RINI_CHANGE_REMOVED)
+            {
+                if (strcmp(value->text, other.values[position].text) != 0) rini_add_change(changes, RINI_CHANGE_MODIFIED, section->name, value->key, strings_size);
+                else if (descriptions && (strcmp(value->desc, other.values[position].desc) != 0)) rini_add_change(changes, RINI_CHANGE_DESCRIPTION, section->name, value->key, strings_size);
+            }
+        }
+    }
+}
+
+// Add change to changes list, strings (section and key) are copied at strings offset
+// NOTE: If changes list is not allocated, only changes count and strings size are computed
+static void rini_add_change(rini_change_list *changes, rini_change_type type, const char *section, const char *key, unsigned int *strings_size)
+{
+    unsigned int section_len = (unsigned int)strlen(section) + 1;
+    unsigned int key_len = (unsigned int)strlen(key) + 1;
+
+    if (changes->changes != NULL)
+    {
+        rini_change *change = &changes->changes[changes->count];
+        change->type = type;
+        change->section = changes->strings + *strings_size;
+        memcpy(changes->strings + *strings_size, section, section_len);
+        change->key = changes->strings + *strings_size + section_len;
+        memcpy(changes->strings + *strings_size + section_len, key, key_len);
+    }
+
+    changes->count++;
+    *strings_size += section_len + key_len;
+}
+
+// Write merged text (theirs changes from base applied to ours) into buffer, returns text length
+// NOTE: Pass NULL buffer to measure text length, conflicts are added to conflicts list
+static unsigned int rini_merge_text(rini_data base, rini_data ours, rini_data theirs, char *buffer, unsigned int size, rini_change_list *conflicts, unsigned int *strings_size)
+{
+    unsigned int offset = 0;
+
+    for (unsigned int s = 0; s < ours.section_count; s++)
+    {
+        const rini_section *section = &ours.sections[s];
+        int base_section = rini_find_section(base, section->name);
+        int theirs_section = rini_find_section(theirs, section->name);
+
+        // Keys added by theirs are placed after section last key,
+        // after section line if no keys, or at the end of global section
+        unsigned int end = section->first + section->count;
+        unsigned int last = end;
+
+        for (unsigned int i = section->first; i < end; i++) if (ours.values[i].key_len > 0) last = i;
+        if ((last == end) && (s > 0)) last = section->first;
+
+        for (unsigned int i = section->first; i < end; i++)
+        {
+            rini_value value = ours.values[i];
+            bool removed = false;
+
+            // NOTE: Only first key is merged in case of duplicates (same as getters)
+            if ((value.key_len > 0) && (rini_find_section_key(ours, (int)s, value.key) == (int)i))
+            {
+                int base_position = rini_find_section_key(base, base_section, value.key);
+                int theirs_position = rini_find_section_key(theirs, theirs_section, value.key);
+                const rini_value *theirs_value = (theirs_position >= 0)? &theirs.values[theirs_position] : NULL;
+
+                if (base_position < 0)
+                {
+                    // Key added by ours (or by both)
+                    if ((theirs_value != NULL) && (strcmp(value.text, theirs_value->text) != 0)) rini_add_change(conflicts, RINI_CHANGE_ADDED, section->name, value.key, strings_size);
+                }
+                else
+                {
+                    const rini_value *base_value = &base.values[base_position];
+                    bool ours_changed = (strcmp(value.text, base_value->text) != 0);
+
+                    if (theirs_value == NULL)
+                    {
+                        // Key removed by theirs, kept if changed by ours
+                        if (!ours_changed) removed = true;
+                        else rini_add_change(conflicts, RINI_CHANGE_REMOVED, section->name, value.key, strings_size);
+                    }
+                    else
+                    {
+                        if (strcmp(theirs_value->text, base_value->text) != 0)
+                        {
+                            if (!ours_changed)
+                            {
+                                value.text = theirs_value->text;
+                                value.text_len = theirs_value->text_len;
+                                value.is_text = theirs_value->is_text;
+                            }
+                            else if (strcmp(value.text, theirs_value->text) != 0) rini_add_change(conflicts, RINI_CHANGE_MODIFIED, section->name, value.key, strings_size);
+                        }
+
+                        if (strcmp(theirs_value->desc, base_value->desc) != 0)
+                        {
+                            if (strcmp(value.desc, base_value->desc) == 0)
+                            {
+                                value.desc = theirs_value->desc;
+                                value.desc_len = theirs_value->desc_len;
+                            }
+                            else if (strcmp(value.desc, theirs_value->desc) != 0) rini_add_change(conflicts, RINI_CHANGE_DESCRIPTION, section->name, value.key, strings_size);
+                        }
+                    }
+                }
+            }
+
+            if (!removed) offset += rini_write_value(&value, buffer, size, offset);
+
+            if (i == last) offset += rini_merge_added(base, base_section, ours, (int)s, theirs, theirs_section, buffer, size, offset, conflicts, strings_size);
+        }
+
+        if (last == end) offset += rini_merge_added(base, base_section, ours, (int)s, theirs, theirs_section, buffer, size, offset, conflicts, strings_size);
+    }
+
+    // Sections added by theirs (or removed by ours), only keys added by theirs are merged
+    for (unsigned int t = 0; t < theirs.section_count; t++)
+    {
+        if (rini_find_section(ours, theirs.sections[t].name) < 0)
+        {
+            offset += rini_merge_added(base, rini_find_section(base, theirs.sections[t].name), ours, -1, theirs, (int)t, buffer, size, offset, conflicts, strings_size);
+        }
+    }
+
+    if ((buffer != NULL) && (size > 0)) buffer[(offset < size)? offset : (size - 1)] = '\0';
+
+    return offset;
+}
+
+// Write theirs section keys not found in ours section into buffer, returns text length
+// NOTE: Keys added by theirs are written, keys removed by ours (and changed by theirs) are conflicts,
+// section line is written before first key if ours section does not exist
+static unsigned int rini_merge_added(rini_data base, int base_section, rini_data ours, int ours_section, rini_data theirs, int theirs_section, char *buffer, unsigned int size, unsigned int offset, rini_change_list *conflicts, unsigned int *strings_size)
+{
+    unsigned int start = offset;
+
+    if (theirs_section >= 0)
+    {
+        const rini_section *section = &theirs.sections[theirs_section];
+        bool section_line = (ours_section >= 0) || (theirs_section == 0);
+
+        for (unsigned int i = section->first; i < (section->first + section->count); i++)
+        {
+            const rini_value *value = &theirs.values[i];
+
+            if ((value->key_len == 0) || (rini_find_section_key(theirs, theirs_section, value->key) != (int)i) ||
+                (rini_find_section_key(ours, ours_section, value->key) >= 0)) continue;
+
+            int base_position = rini_find_section_key(base, base_section, value->key);
+
+            if (base_position < 0)
+            {
+                if (!section_line)
+                {
+                    offset += rini_write_value(&theirs.values[section->first], buffer, size, offset);
+                    section_line = true;
+                }
+
+                offset += rini_write_value(value, buffer, size, offset);
+            }
+            else if (strcmp(value->text, base.values[base_position].text) != 0) rini_add_change(conflicts, RINI_CHANGE_MODIFIED, section->name, value->key, strings_size);
+        }
+    }
+
+    return offset - start;
+}
+
+// Compute text hash (64bit), used to detect file content changes
+// NOTE: Text is processed 8 bytes at once (multiply-xorshift mixing), not a cryptographic hash
+static unsigned long long rini_hash_text(const char *text, unsigned int size)
+{
+    unsigned long long hash = 0x9E3779B97F4A7C15ull ^ size;
+    unsigned int i = 0;
+
+    for (; (i + 8) <= size; i += 8)
+    {
+        unsigned long long word = 0;
+        memcpy(&word, text + i, 8);
+
+        hash = (hash ^ word)*0xFF51AFD7ED558CCDull;
+        hash ^= hash >> 32;
+    }
+
+    if (i < size)
+    {
+        unsigned long long word = 0;
+        memcpy(&word, text + i, size - i);
+
+        hash = (hash ^ word)*0xFF51AFD7ED558CCDull;
+        hash ^= hash >> 32;
+    }
+
+    hash ^= hash >> 29;
+    hash *= 0xC4CEB9FE1A85EC53ull;
+    hash ^= hash >> 32;
+
+    return hash;
+}
+
+#if defined(RINI_SUPPORT_STATS)
+// Get current time in seconds (monotonic, high resolution)
+static double rini_get_time(void)
+{
+    double time = 0.0;
+
+#if defined(_WIN32)
+    long long frequency = 0;
+    long long counter = 0;
+    QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&counter);
+    if (frequency > 0) time = (double)counter/(double)frequency;
+#else
+    struct timespec ts = { 0 };
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    time = (double)ts.tv_sec + (double)ts.tv_nsec*1e-9;
+#endif
+
+    return time;
+}
+
+// Begin phase span (trace callback), returns span start time
+static double rini_trace_begin(const char *name)
+{
+    if (rini_trace != NULL) rini_trace(RINI_TRACE_BEGIN, name, 0, rini_trace_user_data);
+
+    return rini_get_time();
+}
+
+// End phase span (trace callback), returns span duration
+// NOTE: Span size is phase specific: bytes for read, parse and save, values for index
+static double rini_trace_end(const char *name, unsigned long long size, double start_time)
+{
+    double duration = rini_get_time() - start_time;
+
+    if (rini_trace != NULL) rini_trace(RINI_TRACE_END, name, size, rini_trace_user_data);
+
+    return duration;
+}
+#endif
+
+#if defined(RINI_SUPPORT_BINARY)
+// Check binary data is valid: header, layout, checksum and strings
+// NOTE: Values strings offsets and sections are verified, queries never read out of binary data
+static bool rini_binary_check(const unsigned char *data, unsigned int size)
+{
+    bool valid = false;
+
+    if ((data != NULL) && (((size_t)data & 7) == 0) && (size >= sizeof(rini_binary_header)))
+    {
+        const rini_binary_header *header = (const rini_binary_header *)data;
+
+        // Layout is computed from counts, same as rini_save_binary_to_buffer()
+        unsigned long long values_end = (unsigned long long)sizeof(rini_binary_header) + (unsigned long long)header->value_count*sizeof(rini_binary_value);
+        unsigned long long sections_end = values_end + (unsigned long long)header->section_count*sizeof(rini_binary_section);
+        unsigned long long keys_end = sections_end + (unsigned long long)header->slot_count*sizeof(unsigned int);
+        unsigned long long section_keys_end = keys_end + (unsigned long long)header->slot_count*sizeof(unsigned int);
+
+        valid = (memcmp(header->magic, RINI_BINARY_MAGIC, 4) == 0) &&
+                (header->version == RINI_BINARY_VERSION) &&
+                (header->endianness == RINI_BINARY_ENDIANNESS) &&
+                (header->size == size) && (header->reserved == 0) &&
+                (header->slot_count >= 16) && ((header->slot_count & (header->slot_count - 1)) == 0) &&
+                (header->slot_count >= header->value_count*2) &&
+                (header->values_offset == sizeof(rini_binary_header)) &&
+                (header->sections_offset == values_end) &&
+                (header->keys_offset == sections_end) &&
+                (header->section_keys_offset == keys_end) &&
+                (header->strings_offset == section_keys_end) &&
+                ((section_keys_end + header->strings_size) <= size) &&
+                ((header->strings_size == 0) || (data[header->strings_offset + header->strings_size - 1] == '\0')) &&
+                (header->checksum == rini_hash_text((const char *)data + sizeof(rini_binary_header), size - sizeof(rini_binary_header)));
+
+        const rini_binary_value *values = (const rini_binary_value *)(data + header->values_offset);
+        const rini_binary_section *sections = (const rini_binary_section *)(data + header->sections_offset);
+        const unsigned int *keys = (const unsigned int *)(data + header->keys_offset);
+        const unsigned int *section_keys = (const unsigned int *)(data + header->section_keys_offset);
+
+        for (unsigned int i = 0; valid && (i < header->value_count); i++)
+        {
+            const rini_binary_value *value = &values[i];
+
+            valid = (value->key < header->strings_size) && (value->key_len < (header->strings_size - value->key)) &&
+                    (value->text < header->strings_size) && (value->text_len < (header->strings_size - value->text)) &&
+                    (value->desc < header->strings_size) && (value->desc_len < (header->strings_size - value->desc)) &&
+                    (value->section < header->section_count) && (value->type <= RINI_VALUE_BOOL);
+        }
+
+        for (unsigned int i = 0; valid && (i < header->section_count); i++)
+        {
+            valid = (sections[i].name < header->strings_size) && (sections[i].name_len < (header->strings_size - sections[i].name));
+        }
+
+        // NOTE: Used slots can not exceed values count (table at least half empty), probing always ends on an empty slot
+        unsigned int used_keys = 0;
+        unsigned int used_section_keys = 0;
+
+        for (unsigned int i = 0; valid && (i < header->slot_count); i++)
+        {
+            valid = (keys[i] <= header->value_count) && (section_keys[i] <= header->value_count);
+
+            if (keys[i] != 0) used_keys++;
+            if (section_keys[i] != 0) used_section_keys++;
+        }
+
+        valid = valid && (used_keys <= header->value_count) && (used_section_keys <= header->value_count);
+    }
+
+    return valid;
+}
+
+// Probe keys hash table for key, returns key slot or first empty slot if not found
+// NOTE: Section keys table hashes key and section, section -1 probes keys table (any section),
+// probing is bounded to table size (tables without empty slots are rejected by rini_binary_check())
+static unsigned int rini_binary_probe(const unsigned int *slots, unsigned int mask, const rini_binary_value *values, const char *strings, unsigned int hash, int section, const char *key, unsigned int key_len)
+{
+    unsigned int slot = ((section < 0)? hash : (hash + (unsigned int)section*0x9E3779B1u)) & mask;
+
+    for (unsigned int probes = 0; (probes <= mask) && (slots[slot] != 0); probes++)
+    {
+        const rini_binary_value *value = &values[slots[slot] - 1];
+
+        if ((value->hash == hash) && (value->key_len == key_len) && ((section < 0) || (value->section == (unsigned int)section)) &&
+            (memcmp(strings + value->key, key, key_len) == 0)) break;
+
+        slot = (slot + 1) & mask;
+    }
+
+    return slot;
+}
+
+// Find binary value for key, in section if requested (section NULL or empty for global section)
+// NOTE: Found value is provided as a rini_value (strings point into binary), so typed getters are shared
+static bool rini_binary_find(rini_binary binary, bool in_section, const char *section, const char *key, rini_value *value)
+{
+    bool found = false;
+
+    if ((binary.data != NULL) && (key != NULL))
+    {
+        const rini_binary_header *header = (const rini_binary_header *)binary.data;
+        const rini_binary_value *values = (const rini_binary_value *)(binary.data + header->values_offset);
+        const char *strings = (const char *)binary.data + header->strings_offset;
+        const unsigned int *slots = (const unsigned int *)(binary.data + (in_section? header->section_keys_offset : header->keys_offset));
+        int section_index = -1;
+
+        // NOTE: Sections are usually a few, a linear scan over names is used
+        if (in_section)
+        {
+            const rini_binary_section *sections = (const rini_binary_section *)(binary.data + header->sections_offset);
+
+            if ((section == NULL) || (section[0] == '\0')) section_index = (header->section_count > 0)? 0 : -2;
+            else
+            {
+                section_index = -2;
+
+                for (unsigned int i = 1; i < header->section_count; i++)
+                {
+                    if (strcmp(section, strings + sections[i].name) == 0)
+                    {
+                        section_index = (int)i;
+                        break;
+                    }
+                }
+            }
+        }
+
+        if (section_index != -2)
+        {
+            unsigned int key_len = (unsigned int)strlen(key);
+            unsigned int hash = (unsigned int)rini_hash_text(key, key_len);
+            unsigned int slot = rini_binary_probe(slots, header->slot_count - 1, values, strings, hash, section_index, key, key_len);
+
+            if (slots[slot] != 0)
+            {
+                const rini_binary_value *bin = &values[slots[slot] - 1];
+
+                value->key = strings + bin->key;
+                value->key_len = bin->key_len;
+                value->text = strings + bin->text;
+                value->text_len = bin->text_len;
+                value->desc = strings + bin->desc;
+                value->desc_len = bin->desc_len;
+                value->type = (rini_value_type)bin->type;
+                value->is_text = (bin->is_text != 0);
+
+                switch (value->type)
+                {
+                    case RINI_VALUE_INT: value->typed.int_value = (long long)bin->typed; break;
+                    case RINI_VALUE_UINT: value->typed.uint_value = bin->typed; break;
+                    case RINI_VALUE_FLOAT: memcpy(&value->typed.float_value, &bin->typed, sizeof(double)); break;
+                    case RINI_VALUE_BOOL: value->typed.bool_value = (bin->typed != 0); break;
+                    default: break;
+                }
+
+                found = true;
+            }
+        }
+    }
+
+    return found;
+}
+
+// Map file into memory (read-only), returns NULL on failure
+// NOTE: Mapped pages are shared between processes mapping same file
+static const unsigned char *rini_map_file(const char *file_name, unsigned int *size)
+{
+    const unsigned char *data = NULL;
+    *size = 0;
+
+    if (file_name != NULL)
+    {
+#if defined(_WIN32)
+        void *file = CreateFileA(file_name, 0x80000000, 0x00000001, NULL, 3, 0x80, NULL); // GENERIC_READ, FILE_SHARE_READ, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL
+
+        if (file != (void *)(size_t)-1) // INVALID_HANDLE_VALUE
+        {
+            unsigned long file_size = GetFileSize(file, NULL);
+
+            if ((file_size > 0) && (file_size != 0xFFFFFFFF))
+            {
+                void *mapping = CreateFileMappingA(file, NULL, 0x02, 0, 0, NULL); // PAGE_READONLY
+
+                if (mapping != NULL)
+                {
+                    data = (const unsigned char *)MapViewOfFile(mapping, 0x0004, 0, 0, 0); // FILE_MAP_READ
+                    if (data != NULL) *size = (unsigned int)file_size;
+
+                    CloseHandle(mapping);
+                }
+            }
+
+            CloseHandle(file);
+        }
+#else
+        int fd = open(file_name, O_RDONLY);
+
+        if (fd >= 0)
+        {
+            struct stat file_stat = { 0 };
+
+            if ((fstat(fd, &file_stat) == 0) && (file_stat.st_size > 0) && ((unsigned long long)file_stat.st_size <= 0xFFFFFFFFull))
+            {
+                void *mapping = mmap(NULL, (size_t)file_stat.st_size, PROT_READ, MAP_SHARED, fd, 0);
+
+                if (mapping != MAP_FAILED)
+                {
+                    data = (const unsigned char *)mapping;
+                    *size = (unsigned int)file_stat.st_size;
+                }
+            }
+
+            close(fd);
+        }
+#endif
+    }
+
+    return data;
+}
+
+// Unmap file from memory
+static void rini_unmap_file(const unsigned char *data, unsigned int size)
+{
+#if defined(_WIN32)
+    (void)size;
+    UnmapViewOfFile(data);
+#else
+    munmap((void *)data, size);
+#endif
+}
+#endif
+
+// Find first char matching any of provided chars, returns end if not found
+// NOTE: With SIMD available, text is compared in blocks (16 or 32 bytes) building a bitmask of
+// structural chars found, first match is taken from mask lowest bit, one branch per block
+// WARNING: Blocks are read past end, text requires RINI_SCAN_PADDING readable bytes after it
+static char *rini_find_chars(char *ptr, char *end, char c0, char c1, char c2)
+{
+#if (RINI_SIMD_BLOCK_SIZE == 32)
+    const __m256i chars0 = _mm256_set1_epi8(c0);
+    const __m256i chars1 = _mm256_set1_epi8(c1);
+    const __m256i chars2 = _mm256_set1_epi8(c2);
+
+    while (ptr < end)
+    {
+        __m256i block = _mm256_loadu_si256((const __m256i *)ptr);
+        __m256i matches = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(block, chars0), _mm256_cmpeq_epi8(block, chars1)), _mm256_cmpeq_epi8(block, chars2));
+        unsigned int mask = (unsigned int)_mm256_movemask_epi8(matches);
+
+        if (mask != 0)
+        {
+            ptr += rini_count_trailing_zeros(mask);
+            break;
+        }
+
+        ptr += 32;
+    }
+#elif (RINI_SIMD_BLOCK_SIZE == 16)
+    const __m128i chars0 = _mm_set1_epi8(c0);
+    const __m128i chars1 = _mm_set1_epi8(c1);
+    const __m128i chars2 = _mm_set1_epi8(c2);
+
+    while (ptr < end)
+    {
+        __m128i block = _mm_loadu_si128((const __m128i *)ptr);
+        __m128i matches = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(block, chars0), _mm_cmpeq_epi8(block, chars1)), _mm_cmpeq_epi8(block, chars2));
+        unsigned int mask = (unsigned int)_mm_movemask_epi8(matches);
+
+        if (mask != 0)
+        {
+            ptr += rini_count_trailing_zeros(mask);
+            break;
+        }
+
+        ptr += 16;
+    }
+#else
+    while ((ptr < end) && (*ptr != c0) && (*ptr != c1) && (*ptr != c2)) ptr++;
+#endif
+
+    return (ptr < end)? ptr : end;
+}
+
+#if defined(RINI_SIMD_BLOCK_SIZE)
+// Count mask trailing zero bits, mask must not be 0
+static unsigned int rini_count_trailing_zeros(unsigned int mask)
+{
+    unsigned int count = 0;
+
+#if defined(__GNUC__) || defined(__clang__)
+    count = (unsigned int)__builtin_ctz(mask);
+#elif defined(_MSC_VER)
+    unsigned long index = 0;
+    _BitScanForward(&index, mask);
+    count = (unsigned int)index;
+#else
+    while ((mask & 1) == 0) { mask >>= 1; count++; }
+#endif
+
+    return count;
+}
+#endif
+
+// Set value string (key, text or description), provided string is copied
+// NOTE: Previous string memory is reused if new string fits on it, otherwise it's allocated from strings arena
+static void rini_set_string(rini_data *data, const char **str, unsigned int *len, const char *text)
+{
+    unsigned int text_len = (unsigned int)strlen(text);
+    char *copy = NULL;
+
+    // WARNING: Empty strings could point to constant strings, never reused
+    if ((*len > 0) && (text_len <= *len)) copy = (char *)*str;
+    else copy = rini_alloc_string(data, text_len + 1);
+
+    if (copy != NULL)
+    {
+        // NOTE: Using memmove(), provided text could overlap previous string
+        memmove(copy, text, text_len);
+        copy[text_len] = '\0';
+
+        *str = copy;
+        *len = text_len;
+    }
+}
+
+// Allocate string memory from strings arena
+// NOTE: Arena blocks are never moved, previous strings remain valid until data is unloaded
+static char *rini_alloc_string(rini_data *data, unsigned int size)
+{
+    char *str = NULL;
+
+    // NOTE: Data loaded with a memory arena allocates strings directly from it
+    if (data->arena != NULL) str = (char *)rini_alloc(data->arena, size);
+    else
+    {
+        rini_string_block *block = data->strings;
+
+        if ((block == NULL) || ((block->size - block->used) < size))
+        {
+            // New blocks grow geometrically, starting small to keep small configs compact
+            unsigned int block_size = (block == NULL)? RINI_STRING_BLOCK_MIN_SIZE : block->size*2;
+            if (block_size > RINI_STRING_BLOCK_MAX_SIZE) block_size = RINI_STRING_BLOCK_MAX_SIZE;
+            if (block_size < size) block_size = size;
+
+            block = (rini_string_block *)RINI_MALLOC(sizeof(rini_string_block) + block_size);
+
+            if (block != NULL)
+            {
+                block->next = data->strings;
+                block->size = block_size;
+                block->used = 0;
+                data->strings = block;
+            }
+        }
+
+        if (block != NULL)
+        {
+            str = (char *)(block + 1) + block->used;
+            block->used += size;
+        }
+    }
+
+    return str;
+}
+
+// Allocate memory from arena (8-byte aligned) or heap (NULL arena), returns NULL on failure
+// NOTE: A new arena block is added if current one has no space left, previous blocks are kept
+static void *rini_alloc(rini_arena *arena, unsigned int size)
+{
+    void *ptr = NULL;
+
+    if (arena == NULL) ptr = RINI_MALLOC(size);
+    else
+    {
+        unsigned int aligned_size = (size + 7) & ~7u;
+        rini_string_block *block = arena->blocks;
+
+        if ((block == NULL) || ((block->size - block->used) < aligned_size))
+        {
+            block = rini_arena_add_block(arena, (aligned_size > arena->block_size)? aligned_size : arena->block_size);
+        }
+
+        if (block != NULL)
+        {
+            ptr = (unsigned char *)(block + 1) + block->used;
+            block->used += aligned_size;
+        }
+    }
+
+    return ptr;
+}
+
+// Free memory allocated with rini_alloc(), arena memory is only released on arena reset
+static void rini_free(rini_arena *arena, void *ptr)
+{
+    if (arena == NULL) RINI_FREE(ptr);
+}
+
+// Add new block to arena, it becomes current block
+// NOTE: Block data follows the header, header size keeps block data 8-byte aligned
+static rini_string_block *rini_arena_add_block(rini_arena *arena, unsigned int size)
+{
+    rini_string_block *block = (rini_string_block *)RINI_MALLOC(sizeof(rini_string_block) + size);
+
+    if (block != NULL)
+    {
+        block->next = arena->blocks;
+        block->size = size;
+        block->used = 0;
+        arena->blocks = block;
+    }
+
+    return block;
+}
+
+// Grow values capacity (geometrically), returns false if not possible
+// NOTE: Values are moved to a new array, positions do not change so keys indexes remain valid
+static bool rini_grow_values(rini_data *data)
+{
+    bool result = false;
+    unsigned int capacity = (data->capacity == 0)? RINI_INITIAL_VALUE_CAPACITY : data->capacity*2;
+
+#if (RINI_MAX_VALUE_CAPACITY > 0)
+    if (capacity > RINI_MAX_VALUE_CAPACITY) capacity = RINI_MAX_VALUE_CAPACITY;
+#endif
+
+    if (capacity > data->capacity)
+    {
+        rini_value *values = (rini_value *)rini_alloc(data->arena, capacity*sizeof(rini_value));
+
+        if (values != NULL)
+        {
+            if (data->count > 0) memcpy(values, data->values, data->count*sizeof(rini_value));
+            rini_free(data->arena, data->values);
+
+            data->values = values;
+            data->capacity = capacity;
+            result = true;
+        }
+    }
+
+    return result;
+}
+
+// Write value line into buffer at offset, returns line length
+// NOTE: Line is formatted manually (no printf-family calls), same output as:
+// "%-*s %c %-*s %c %s\n" -> [key][key-spacing] [delimiter] [value][value-spacing] [desc-delimiter] [desc]
+static unsigned int rini_write_value(const rini_value *value, char *buffer, unsigned int size, unsigned int offset)
+{
+    // Line fits into buffer, written with no bounds checks
+    if ((buffer != NULL) && (offset < size) && (rini_line_bound(value) < (size - offset))) return rini_write_line(value, buffer + offset);
+
+    unsigned int start = offset;
+
+    if (value->is_section)
+    {
+        offset += rini_write_chars(buffer, size, offset, RINI_LINE_SECTION_DELIMITER, 1);
+        offset += rini_write_text(buffer, size, offset, value->text, value->text_len);
+        offset += rini_write_chars(buffer, size, offset, ']', 1);
+
+        if (value->desc_len > 0)
+        {
+            offset += rini_write_chars(buffer, size, offset, ' ', 1);
+            offset += rini_write_chars(buffer, size, offset, RINI_DESCRIPTION_DELIMITER, 1);
+            offset += rini_write_chars(buffer, size, offset, ' ', 1);
+            offset += rini_write_text(buffer, size, offset, value->desc, value->desc_len);
+        }
+    }
+    else if ((value->key_len == 0) && (value->text_len == 0))
+    {
+        // Empty line: NULL, NULL, NULL
+        // Empty comment line: NULL, NULL, " "
+        // Comment line: NULL, NULL, "comment"
+        if (value->desc_len > 0) offset += rini_write_chars(buffer, size, offset, RINI_LINE_COMMENT_DELIMITER, 1);
+        if ((value->desc_len > 1) || ((value->desc_len == 1) && (value->desc[0] != ' '))) offset += rini_write_text(buffer, size, offset, value->desc, value->desc_len);
+    }
+    else
+    {
+        unsigned int value_len = value->text_len;
+
+#if RINI_USE_TEXT_QUOTATION_MARKS
+        // Add quotation marks if required, considered for value spacing
+        if (value->is_text) value_len += 2;
+#endif
+        offset += rini_write_text(buffer, size, offset, value->key, value->key_len);
+        if (value->key_len < RINI_KEY_SPACING) offset += rini_write_chars(buffer, size, offset, ' ', RINI_KEY_SPACING - value->key_len);
+        offset += rini_write_chars(buffer, size, offset, ' ', 1);
+        offset += rini_write_chars(buffer, size, offset, RINI_VALUE_DELIMITER, 1);
+        offset += rini_write_chars(buffer, size, offset, ' ', 1);
+
+#if RINI_USE_TEXT_QUOTATION_MARKS
+        if (value->is_text) offset += rini_write_chars(buffer, size, offset, RINI_VALUE_QUOTATION_MARKS, 1);
+#endif
+        offset += rini_write_text(buffer, size, offset, value->text, value->text_len);
+#if RINI_USE_TEXT_QUOTATION_MARKS
+        if (value->is_text) offset += rini_write_chars(buffer, size, offset, RINI_VALUE_QUOTATION_MARKS, 1);
+#endif
+        // Add description if required
+        if (value->desc_len > 0)
+        {
+            if (value_len < RINI_VALUE_SPACING) offset += rini_write_chars(buffer, size, offset, ' ', RINI_VALUE_SPACING - value_len);
+            offset += rini_write_chars(buffer, size, offset, ' ', 1);
+            offset += rini_write_chars(buffer, size, offset, RINI_DESCRIPTION_DELIMITER, 1);
+            offset += rini_write_chars(buffer, size, offset, ' ', 1);
+            offset += rini_write_text(buffer, size, offset, value->desc, value->desc_len);
+        }
+    }
+
+    offset += rini_write_chars(buffer, size, offset, '\n', 1);
+
+    return offset - start;
+}
+
+// Write value line with no bounds checks, returns line length
+// NOTE: Line must have room for rini_line_bound() chars, same output as rini_write_value()
+static unsigned int rini_write_line(const rini_value *value, char *line)
+{
+    char *ptr = line;
+
+    if (value->is_section)
+    {
+        *ptr++ = RINI_LINE_SECTION_DELIMITER;
+        memcpy(ptr, value->text, value->text_len);
+        ptr += value->text_len;
+        *ptr++ = ']';
+
+        if (value->desc_len > 0)
+        {
+            *ptr++ = ' ';
+            *ptr++ = RINI_DESCRIPTION_DELIMITER;
+            *ptr++ = ' ';
+            memcpy(ptr, value->desc, value->desc_len);
+            ptr += value->desc_len;
+        }
+    }
+    else if ((value->key_len == 0) && (value->text_len == 0))
+    {
+        if (value->desc_len > 0) *ptr++ = RINI_LINE_COMMENT_DELIMITER;
+        if ((value->desc_len > 1) || ((value->desc_len == 1) && (value->desc[0] != ' ')))
+        {
+            memcpy(ptr, value->desc, value->desc_len);
+            ptr += value->desc_len;
+        }
+    }
+    else
+    {
+        unsigned int value_len = value->text_len;
+
+#if RINI_USE_TEXT_QUOTATION_MARKS
+        if (value->is_text) value_len += 2;
+#endif
+        // NOTE: Spacing is written first with constant size (inlined by compiler), then overwritten
+        memset(ptr, ' ', RINI_KEY_SPACING);
+        memcpy(ptr, value->key, value->key_len);
+        ptr += (value->key_len < RINI_KEY_SPACING)? RINI_KEY_SPACING : value->key_len;
+
+        *ptr++ = ' ';
+        *ptr++ = RINI_VALUE_DELIMITER;
+        *ptr++ = ' ';
+
+        char *value_start = ptr;
+        memset(ptr, ' ', RINI_VALUE_SPACING);
+#if RINI_USE_TEXT_QUOTATION_MARKS
+        if (value->is_text) *ptr++ = RINI_VALUE_QUOTATION_MARKS;
+#endif
+        memcpy(ptr, value->text, value->text_len);
+        ptr += value->text_len;
+#if RINI_USE_TEXT_QUOTATION_MARKS
+        if (value->is_text) *ptr++ = RINI_VALUE_QUOTATION_MARKS;
+#endif
+        if (value->desc_len > 0)
+        {
+            if (value_len < RINI_VALUE_SPACING) ptr = value_start + RINI_VALUE_SPACING;
+
+            *ptr++ = ' ';
+            *ptr++ = RINI_DESCRIPTION_DELIMITER;
+            *ptr++ = ' ';
+            memcpy(ptr, value->desc, value->desc_len);
+            ptr += value->desc_len;
+        }
+    }
+
+    *ptr++ = '\n';
+
+    return (unsigned int)(ptr - line);
+}
+
+// Get value line length upper bound, formatted line is never longer
+// NOTE: Spacing, delimiters, quotation marks and line end are all considered
+static unsigned int rini_line_bound(const rini_value *value)
+{
+    return value->key_len + value->text_len + value->desc_len + RINI_KEY_SPACING + RINI_VALUE_SPACING + 16;
+}
+
+// Save data into new allocated text ('\0' ended), returns NULL on failure
+// NOTE: Lines are formatted in a single pass (no measuring pass), text capacity is estimated from
+// source size and values count (pages not written are never touched), it grows geometrically if a line does not fit
+static char *rini_save_text(rini_data data, unsigned int *size)
+{
+    unsigned int capacity = data.source_size + data.source_size/2 + data.count*(RINI_KEY_SPACING + RINI_VALUE_SPACING) + 256;
+    unsigned int offset = 0;
+    char *text = (char *)RINI_MALLOC(capacity);
+
+    for (unsigned int i = 0; (text != NULL) && (i < data.count); i++)
+    {
+        const rini_value *value = &data.values[i];
+        unsigned int bound = rini_line_bound(value);
+
+        if (bound >= (capacity - offset))
+        {
+            while (bound >= (capacity - offset)) capacity *= 2;
+
+            char *grown = (char *)RINI_MALLOC(capacity);
+            if (grown != NULL) memcpy(grown, text, offset);
+
+            RINI_FREE(text);
+            text = grown;
+            if (text == NULL) break;
+        }
+
+        offset += rini_write_line(value, text + offset);
+    }
+
+    if (text != NULL) text[offset] = '\0';
+    *size = (text != NULL)? offset : 0;
+
+    return text;
+}
+
+// Write text into buffer at offset, returns text length
+// NOTE: Only text fitting into buffer is copied (keeping room for '\0'), but full length is returned
+static unsigned int rini_write_text(char *buffer, unsigned int size, unsigned int offset, const char *text, unsigned int len)
+{
+    if ((buffer != NULL) && ((offset + 1) < size))
+    {
+        unsigned int available = size - offset - 1;
+        memcpy(buffer + offset, text, (len < available)? len : available);
+    }
+
+    return len;
+}
+
+// Write repeated char into buffer at offset, returns chars count
+// NOTE: Only chars fitting into buffer are written (keeping room for '\0'), but full count is returned
+static unsigned int rini_write_chars(char *buffer, unsigned int size, unsigned int offset, char c, unsigned int count)
+{
+    if ((buffer != NULL) && ((offset + 1) < size))
+    {
+        unsigned int available = size - offset - 1;
+        memset(buffer + offset, c, (count < available)? count : available);
+    }
+
+    return count;
+}
+
+// Convert int value to text, returns text length
+// NOTE: Text must have room for at least 21 chars (including '\0')
+static unsigned int rini_int_to_text(long long value, char *text)
+{
+    unsigned int len = 0;
+
+    // NOTE: Using unsigned value to support INT64_MIN
+    if (value < 0)
+    {
+        text[0] = '-';
+        len = 1 + rini_uint_to_text(0ULL - (unsigned long long)value, text + 1);
+    }
+    else len = rini_uint_to_text((unsigned long long)value, text);
+
+    return len;
+}
+
+// Convert unsigned int value to text, returns text length
+// NOTE: Text must have room for at least 21 chars (including '\0')
+static unsigned int rini_uint_to_text(unsigned long long value, char *text)
+{
+    char digits[20] = { 0 };
+    unsigned int len = 0;
+    unsigned int count = 0;
+
+    do
+    {
+        digits[count++] = (char)('0' + (value%10));
+        value /= 10;
+    } while (value > 0);
+
+    while (count > 0) text[len++] = digits[--count];
+    text[len] = '\0';
+
+    return len;
+}
+
+// Convert double value to text, returns text length
+// NOTE: Shortest text reading back the same value is used, '.' is always the decimal point (independent of locale),
+// integral values keep a decimal part to be typed as decimal. Text must have room for at least 32 chars
+// Locale is not queried (localeconv() is not thread-safe), snprintf() decimal point is any char (or chars sequence)
+// that is not a digit, sign, exponent or letter (inf/nan), replaced by '.'
+static unsigned int rini_double_to_text(double value, char *text)
+{
+    unsigned int len = 0;
+
+    // Find shortest precision reading back the same value (max 17 digits required)
+    for (int precision = 15; precision <= 17; precision++)
+    {
+        int count = snprintf(text, 32, "%.*g", precision, value);
+        unsigned int written = ((count > 0) && (count < 32))? (unsigned int)count : 0;
+
+        len = 0;
+        for (unsigned int i = 0; i < written; i++)
+        {
+            char c = text[i];
+            bool number = ((c >= '0') && (c <= '9')) || (c == '+') || (c == '-') || ((c >= 'a') && (c <= 'z')) || ((c >= 'A') && (c <= 'Z'));
+
+            if (number) text[len++] = c;
+            else if ((len == 0) || (text[len - 1] != '.')) text[len++] = '.';
+        }
+        text[len] = '\0';
+
+        rini_value check = { 0 };
+        check.text = text;
+        check.text_len = len;
+        rini_resolve_value(&check);
+
+        if ((check.type == RINI_VALUE_FLOAT) && (check.typed.float_value == value)) break;
+        if ((check.type == RINI_VALUE_INT) && ((double)check.typed.int_value == value)) break;
+        if ((check.type == RINI_VALUE_UINT) && ((double)check.typed.uint_value == value)) break;
+    }
+
+    // Integral values require a decimal part (i.e. 2.0), infinite and NaN values are kept as text
+    bool decimal = false;
+    for (unsigned int i = 0; i < len; i++) if ((text[i] == '.') || (text[i] == 'e') || (text[i] == 'n') || (text[i] == 'N')) decimal = true;
+
+    if (!decimal && (len < 30))
+    {
+        text[len++] = '.';
+        text[len++] = '0';
+        text[len] = '\0';
+    }
+
+    return len;
+}
+
+// Convert text to int value (if possible), same as atoi()
+static int rini_text_to_int(const char *text)
+{
+    int value = 0;
+    int sign = 1;
+
+    if ((text[0] == '+') || (text[0] == '-'))
+    {
+        if (text[0] == '-') sign = -1;
+        text++;
+    }
+
+    int i = 0;
+    for (; ((text[i] >= '0') && (text[i] <= '9')); i++) value = value*10 + (int)(text[i] - '0');
+
+    //if (strlen(text) != i) // Text starts with numbers but contains some text after that...
+
+    return value*sign;
+}
+
+// Resolve value type and typed representation from value text
+// NOTE: Text must be a complete number (or true/false) to be typed, otherwise considered text:
+//   integer: [+-]digits, in 64-bit range (bigger values considered decimal)
+//   decimal: [+-]digits.digits[(e|E)[+-]digits], at least one digit required
+//   boolean: true/false (case-insensitive)
+// Numbers parsing is locale-independent ('.' decimal point), with overflow detection,
+// up to 19 significant digits are read into a 64-bit mantissa (8 digits at once when possible),
+// decimal values are computed exactly from mantissa if possible (Clinger fast path), strtod() used otherwise
+static void rini_resolve_value(rini_value *value)
+{
+    const char *text = value->text;
+    unsigned int len = value->text_len;
+    unsigned int i = 0;
+
+    value->type = RINI_VALUE_STRING;
+    value->typed.int_value = 0;
+
+    bool negative = false;
+    if ((i < len) && ((text[i] == '+') || (text[i] == '-')))
+    {
+        negative = (text[i] == '-');
+        i++;
+    }
+
+    unsigned int sign = i;              // Sign length, number digits start
+    unsigned long long mantissa = 0;    // Number significant digits
+    unsigned int significant = 0;       // Number significant digits count (in mantissa)
+    unsigned int digits = 0;            // Number digits count (including leading zeros)
+    int exponent = 0;                   // Number decimal exponent, applied to mantissa
+    bool exact = true;                  // Mantissa contains all non-zero digits
+    bool integer = true;                // Number is integer (no decimal part or exponent)
+
+    // Integer part, leading zeros skipped
+    while ((i < len) && (text[i] == '0')) { i++; digits++; }
+
+    unsigned int int_start = i;
+    i = rini_read_digits(text, len, i, false, &mantissa, &significant, &exponent, &exact);
+    unsigned int int_digits = i - int_start;
+    digits += int_digits;
+
+    // Decimal part, leading zeros skipped if no significant digits yet
+    if ((i < len) && (text[i] == '.'))
+    {
+        integer = false;
+        unsigned int dec_start = ++i;
+
+        if (significant == 0) while ((i < len) && (text[i] == '0')) { i++; exponent--; }
+
+        i = rini_read_digits(text, len, i, true, &mantissa, &significant, &exponent, &exact);
+        digits += i - dec_start;
+    }
+
+    // Exponent part
+    if ((digits > 0) && (i < len) && ((text[i] == 'e') || (text[i] == 'E')))
+    {
+        int exp_value = 0;
+        unsigned int exp_start = 0;
+        bool exp_negative = false;
+
+        integer = false;
+        i++;
+
+        if ((i < len) && ((text[i] == '+') || (text[i] == '-')))
+        {
+            exp_negative = (text[i] == '-');
+            i++;
+        }
+
+        // NOTE: Exponent is clamped, it already overflows/underflows any double
+        for (exp_start = i; (i < len) && (text[i] >= '0') && (text[i] <= '9'); i++) if (exp_value < 100000) exp_value = exp_value*10 + (text[i] - '0');
+
+        if (i == exp_start) digits = 0; // Exponent without digits, not a number
+        exponent += exp_negative? -exp_value : exp_value;
+    }
+
+    if ((digits > 0) && (i == len))
+    {
+        if (integer && (int_digits <= 20))
+        {
+            // Integer value, last digit added if dropped (20 digits), checking overflow
+            unsigned long long number = mantissa;
+            unsigned int last = (unsigned int)(text[len - 1] - '0');
+            bool overflow = false;
+
+            if (int_digits == 20)
+            {
+                if (mantissa <= (18446744073709551615ULL - last)/10) number = mantissa*10 + last;
+                else overflow = true;
+            }
+
+            if (!overflow && negative && (number <= 9223372036854775808ULL))
+            {
+                value->type = RINI_VALUE_INT;
+                value->typed.int_value = (long long)(0ULL - number);
+            }
+            else if (!overflow && !negative && (number <= 9223372036854775807ULL))
+            {
+                value->type = RINI_VALUE_INT;
+                value->typed.int_value = (long long)number;
+            }
+            else if (!overflow && !negative)
+            {
+                value->type = RINI_VALUE_UINT;
+                value->typed.uint_value = number;
+            }
+        }
+
+        if (value->type == RINI_VALUE_STRING)
+        {
+            // Decimal value (or integer out of range)
+            // NOTE: Exact powers of 10 in double: 1e0..1e22, mantissa exact if not bigger than 2^53
+            static const double powers[23] = {
+                1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+                1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+            };
+
+            double number = 0.0;
+
+            if (mantissa == 0) number = 0.0;
+            else if (exact && (mantissa <= 9007199254740992ULL) && (exponent >= -22) && (exponent <= 22))
+            {
+                number = (double)mantissa;
+                if (exponent < 0) number /= powers[-exponent];
+                else number *= powers[exponent];
+            }
+            else number = rini_text_to_double(text + sign, len - sign);
+
+            value->type = RINI_VALUE_FLOAT;
+            value->typed.float_value = negative? -number : number;
+        }
+    }
+    else
+    {
+        // Check boolean values, case-insensitive
+        const char *boolean = (len == 4)? "true" : ((len == 5)? "false" : NULL);
+
+        if (boolean != NULL)
+        {
+            for (i = 0; (i < len) && ((text[i] | 0x20) == boolean[i]); i++) { }
+
+            if (i == len)
+            {
+                value->type = RINI_VALUE_BOOL;
+                value->typed.bool_value = (len == 4);
+            }
+        }
+    }
+}
+
+// Read number digits into mantissa (up to 19 significant digits), returns position after digits
+// NOTE: Digits are read 8 at once while possible, integer digits dropped increase exponent,
+// decimal digits read decrease exponent, exact set to false if non-zero digits dropped
+static unsigned int rini_read_digits(const char *text, unsigned int len, unsigned int i, bool decimal, unsigned long long *mantissa, unsigned int *significant, int *exponent, bool *exact)
+{
+    unsigned int chunk = 0;
+
+    while (((i + 8) <= len) && ((*significant + 8) <= 19) && rini_read_eight_digits(text + i, &chunk))
+    {
+        *mantissa = *mantissa*100000000ULL + chunk;
+        *significant += 8;
+        if (decimal) *exponent -= 8;
+        i += 8;
+    }
+
+    for (; (i < len) && (text[i] >= '0') && (text[i] <= '9'); i++)
+    {
+        if (*significant < 19)
+        {
+            *mantissa = *mantissa*10 + (unsigned int)(text[i] - '0');
+            (*significant)++;
+            if (decimal) (*exponent)--;
+        }
+        else
+        {
+            if (!decimal) (*exponent)++;
+            if (text[i] != '0') *exact = false;
+        }
+    }
+
+    return i;
+}
+
+// Read 8 digits at once, returns false if any char is not a digit
+// NOTE: SWAR (SIMD within a register): digits are checked and combined in pairs using 64-bit operations
+static bool rini_read_eight_digits(const char *text, unsigned int *value)
+{
+    bool valid = false;
+
+#if RINI_LITTLE_ENDIAN
+    unsigned long long chunk = 0;
+    memcpy(&chunk, text, 8);
+
+    // Check all bytes are in ['0'..'9'] range: high nibble 3 and adding 6 does not overflow the low nibble
+    if (((chunk & 0xF0F0F0F0F0F0F0F0ULL) | (((chunk + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >> 4)) == 0x3333333333333333ULL)
+    {
+        chunk = ((chunk & 0x0F0F0F0F0F0F0F0FULL)*2561) >> 8;                // 2 digits per 16-bit
+        chunk = ((chunk & 0x00FF00FF00FF00FFULL)*6553601) >> 16;            // 4 digits per 32-bit
+        *value = (unsigned int)(((chunk & 0x0000FFFF0000FFFFULL)*42949672960001ULL) >> 32); // 8 digits
+        valid = true;
+    }
+#else
+    unsigned int number = 0;
+    unsigned int i = 0;
+
+    for (; (i < 8) && (text[i] >= '0') && (text[i] <= '9'); i++) number = number*10 + (unsigned int)(text[i] - '0');
+
+    if (i == 8)
+    {
+        *value = number;
+        valid = true;
+    }
+#endif
+
+    return valid;
+}
+
+// Convert text to double with strtod(), independent of locale decimal point
+// NOTE: Used only for decimal values that can not be computed exactly with fast path, text is rewritten as
+// digits and decimal exponent (no decimal point), so locale is not checked (localeconv() is not thread-safe)
+// WARNING: Text must be a valid unsigned decimal number, see rini_resolve_value()
+static double rini_text_to_double(const char *text, unsigned int len)
+{
+    double value = 0.0;
+    char local[64] = { 0 };
+    char *number = ((len + 24) <= 64)? local : (char *)RINI_MALLOC(len + 24);
+
+    if (number != NULL)
+    {
+        unsigned int count = 0;
+        unsigned int i = 0;
+        long long exponent = 0;
+        bool decimal = false;
+
+        // Digits copied without decimal point, every decimal digit decreases exponent
+        for (; (i < len) && (text[i] != 'e') && (text[i] != 'E'); i++)
+        {
+            if (text[i] == '.') decimal = true;
+            else
+            {
+                number[count++] = text[i];
+                if (decimal) exponent--;
+            }
+        }
+
+        // Exponent part, clamped same as rini_resolve_value()
+        if (i < len)
+        {
+            long long exp_value = 0;
+            bool exp_negative = false;
+
+            i++;
+
+            if ((i < len) && ((text[i] == '+') || (text[i] == '-')))
+            {
+                exp_negative = (text[i] == '-');
+                i++;
+            }
+
+            for (; i < len; i++) if (exp_value < 100000) exp_value = exp_value*10 + (text[i] - '0');
+
+            exponent += exp_negative? -exp_value : exp_value;
+        }
+
+        number[count++] = 'e';
+        rini_int_to_text(exponent, number + count);
+
+        value = strtod(number, NULL);
+
+        if (number != local) RINI_FREE(number);
+    }
+
+    return value;
+}
+
+// Get value as int from typed representation, text values converted as atoi()
+// NOTE: Numbers out of int range are clamped
+static int rini_value_to_int(const rini_value *value)
+{
+    int result = 0;
+
+    switch (value->type)
+    {
+        case RINI_VALUE_INT:
+        {
+            if (value->typed.int_value > 2147483647LL) result = 2147483647;
+            else if (value->typed.int_value < -2147483647LL - 1) result = -2147483647 - 1;
+            else result = (int)value->typed.int_value;
+        } break;
+        case RINI_VALUE_FLOAT:
+        {
+            if (value->typed.float_value >= 2147483647.0) result = 2147483647;
+            else if (value->typed.float_value <= -2147483648.0) result = -2147483647 - 1;
+            else if (value->typed.float_value == value->typed.float_value) result = (int)value->typed.float_value; // NaN check
+        } break;
+        case RINI_VALUE_UINT: result = 2147483647; break;
+        case RINI_VALUE_BOOL: result = value->typed.bool_value? 1 : 0; break;
+        case RINI_VALUE_STRING: result = rini_text_to_int(value->text); break;
+        default: break;
+    }
+
+    return result;
+}
+
+// Get value as int, only integer values (in int range) are valid
+static bool rini_value_try_int(const rini_value *value, int *result)
+{
+    bool valid = false;
+
+    if ((value->type == RINI_VALUE_INT) && (value->typed.int_value <= 2147483647LL) && (value->typed.int_value >= (-2147483647LL - 1)))
+    {
+        *result = (int)value->typed.int_value;
+        valid = true;
+    }
+
+    return valid;
+}
+
+// Get value as bool, only boolean values or integer 0/1 are valid
+static bool rini_value_try_bool(const rini_value *value, bool *result)
+{
+    bool valid = false;
+
+    if (value->type == RINI_VALUE_BOOL)
+    {
+        *result = value->typed.bool_value;
+        valid = true;
+    }
+    else if ((value->type == RINI_VALUE_INT) && ((value->typed.int_value == 0) || (value->typed.int_value == 1)))
+    {
+        *result = (value->typed.int_value == 1);
+        valid = true;
+    }
+
+    return valid;
+}
+
+// Get value as int64, only integer values (in int64 range) are valid
+static bool rini_value_try_int64(const rini_value *value, long long *result)
+{
+    bool valid = false;
+
+    if (value->type == RINI_VALUE_INT)
+    {
+        *result = value->typed.int_value;
+        valid = true;
+    }
+
+    return valid;
+}
+
+// Get value as uint64, only non-negative integer values are valid
+static bool rini_value_try_uint64(const rini_value *value, unsigned long long *result)
+{
+    bool valid = false;
+
+    if ((value->type == RINI_VALUE_INT) && (value->typed.int_value >= 0))
+    {
+        *result = (unsigned long long)value->typed.int_value;
+        valid = true;
+    }
+    else if (value->type == RINI_VALUE_UINT)
+    {
+        *result = value->typed.uint_value;
+        valid = true;
     }
+
+    return valid;
 }
 
-// Save data to text buffer ('\0' EOL)
-char *rini_save_to_memory(rini_data data)
+// Get value as double, integer and decimal values are valid
+// NOTE: Integer values bigger than 2^53 could lose precision
+static bool rini_value_try_double(const rini_value *value, double *result)
 {
-    // Verify required data size is smaller than memory buffer size
-    // NOTE: Adding 64 extra possible characters by entry line
-    int requiredSize = 0;
-    for (unsigned int i = 0; i < data.count; i++) requiredSize += ((int)strlen(data.values[i].key) + (int)strlen(data.values[i].text) + (int)strlen(data.values[i].desc) + 64);
-    if (requiredSize > RINI_MAX_TEXT_FILE_SIZE) RINI_LOG("WARNING: Required data.ini size is bigger than max supported memory size, increase RINI_MAX_TEXT_FILE_SIZE\n");
+    bool valid = true;
 
-    // NOTE: Using a static buffer to avoid de-allocation requirement on user side
-    static char text[RINI_MAX_TEXT_FILE_SIZE] = { 0 };
-    memset(text, 0, RINI_MAX_TEXT_FILE_SIZE);
-    int offset = 0;
+    if (value->type == RINI_VALUE_FLOAT) *result = value->typed.float_value;
+    else if (value->type == RINI_VALUE_INT) *result = (double)value->typed.int_value;
+    else if (value->type == RINI_VALUE_UINT) *result = (double)value->typed.uint_value;
+    else valid = false;
+
+    return valid;
+}
 
-    char valuestr[RINI_MAX_TEXT_SIZE + 2] = { 0 }; // Useful for text processing, adding quotation marks if required
+// Get value as field type, result not modified if not valid
+// NOTE: Text fields are always valid, result points to value text
+static bool rini_value_try_field(const rini_value *value, rini_field_type type, void *result)
+{
+    bool valid = false;
 
-    for (unsigned int i = 0; i < data.count; i++)
+    if (result != NULL)
     {
-        if ((data.values[i].key[0] == '\0') && (data.values[i].text[0] == RINI_LINE_COMMENT_DELIMITER))
-        {
-            if (data.values[i].desc[0] != '\0') offset += snprintf(text + offset, RINI_MAX_LINE_SIZE, "%c %s\n", RINI_LINE_COMMENT_DELIMITER, data.values[i].desc);
-            else offset += snprintf(text + offset, RINI_MAX_LINE_SIZE, "%c\n", RINI_LINE_COMMENT_DELIMITER);
-        }
-        else
+        switch (type)
         {
-            memset(valuestr, 0, RINI_MAX_TEXT_SIZE + 2);
-#if RINI_USE_TEXT_QUOTATION_MARKS
-            // Add quotation marks if required
-            if (data.values[i].is_text) snprintf(valuestr, RINI_MAX_TEXT_SIZE + 2, "%c%s%c", RINI_VALUE_QUOTATION_MARKS, data.values[i].text, RINI_VALUE_QUOTATION_MARKS);
-#else
-            snprintf(valuestr, RINI_MAX_TEXT_SIZE + 2, "%s", data.values[i].text);
-#endif
-            // Add description if required
-            if (data.values[i].desc[0] != '\0')
-            {
-                offset += snprintf(text + offset, RINI_MAX_LINE_SIZE, "%-*s %c %-*s %c %s\n", RINI_KEY_SPACING, data.values[i].key, RINI_VALUE_DELIMITER,
-                        RINI_VALUE_SPACING, data.values[i].is_text? valuestr : data.values[i].text,
-                        RINI_DESCRIPTION_DELIMITER, data.values[i].desc);
-            }
-            else
-            {
-                // No description required
-                offset += snprintf(text + offset, RINI_MAX_LINE_SIZE, "%-*s %c %s\n", RINI_KEY_SPACING, data.values[i].key, RINI_VALUE_DELIMITER,
-                        data.values[i].is_text? valuestr : data.values[i].text);
-            }
+            case RINI_FIELD_INT: valid = rini_value_try_int(value, (int *)result); break;
+            case RINI_FIELD_BOOL: valid = rini_value_try_bool(value, (bool *)result); break;
+            case RINI_FIELD_INT64: valid = rini_value_try_int64(value, (long long *)result); break;
+            case RINI_FIELD_UINT64: valid = rini_value_try_uint64(value, (unsigned long long *)result); break;
+            case RINI_FIELD_DOUBLE: valid = rini_value_try_double(value, (double *)result); break;
+            case RINI_FIELD_TEXT: *(const char **)result = value->text; valid = true; break;
+            default: break;
         }
     }
 
-    return text;
+    return valid;
 }
 
-// Unload data
-void rini_unload(rini_data *data)
+// Get field type C type size
+static unsigned int rini_field_size(rini_field_type type)
 {
-    RINI_FREE(data->values);
+    unsigned int size = 0;
 
-    data->values = NULL;
-    data->count = 0;
-    data->capacity = 0;
+    switch (type)
+    {
+        case RINI_FIELD_INT: size = sizeof(int); break;
+        case RINI_FIELD_BOOL: size = sizeof(bool); break;
+        case RINI_FIELD_INT64: size = sizeof(long long); break;
+        case RINI_FIELD_UINT64: size = sizeof(unsigned long long); break;
+        case RINI_FIELD_DOUBLE: size = sizeof(double); break;
+        case RINI_FIELD_TEXT: size = sizeof(const char *); break;
+        default: break;
+    }
+
+    return size;
 }
 
-// Get value for provided key, returns 0 if not found or not valid
-int rini_get_value(rini_data data, const char *key)
+// Find value position for provided key, returns -1 if not found
+// NOTE: In case of duplicate keys, first entry is returned
+static int rini_find_key(rini_data data, const char *key)
 {
-    int value = 0;
+    int position = rini_index_find(data.index, data.values, data.count, key);
 
-    for (unsigned int i = 0; i < data.count; i++)
+    return position;
+}
+
+// Find value position for provided key (getters, statistics updated), returns -1 if not found
+static int rini_lookup_key(rini_data data, const char *key)
+{
+    int position = rini_find_key(data, key);
+
+#if defined(RINI_SUPPORT_STATS)
+    if (data.stats != NULL)
     {
-        if (strcmp(key, data.values[i].key) == 0) // Key found
-        {
-            value = rini_text_to_int(data.values[i].text);
-            break;
-        }
+        data.stats->lookups++;
+        if (position >= 0) data.stats->hits++;
+        else data.stats->misses++;
     }
 
-    return value;
+    if (rini_trace != NULL) rini_trace((position >= 0)? RINI_TRACE_HIT : RINI_TRACE_MISS, key, 0, rini_trace_user_data);
+#endif
+
+    return position;
 }
 
-// Get value for provided key with default value fallback if not found or not valid
-int rini_get_value_fallback(rini_data data, const char *key, int fallback)
+// Find value position for provided key in section (getters, statistics updated), returns -1 if not found
+static int rini_lookup_section_key(rini_data data, const char *section, const char *key)
 {
-    int value = fallback;
+    int position = rini_find_section_key(data, rini_find_section(data, section), key);
 
-    for (unsigned int i = 0; i < data.count; i++)
+#if defined(RINI_SUPPORT_STATS)
+    if (data.stats != NULL)
     {
-        if (strcmp(key, data.values[i].key) == 0) // Key found
-        {
-            // TODO: Detect if conversion fails...
-            value = rini_text_to_int(data.values[i].text);
-            break;
-        }
+        data.stats->lookups++;
+        if (position >= 0) data.stats->hits++;
+        else data.stats->misses++;
     }
 
-    return value;
+    if (rini_trace != NULL) rini_trace((position >= 0)? RINI_TRACE_HIT : RINI_TRACE_MISS, key, 0, rini_trace_user_data);
+#endif
+
+    return position;
 }
 
-// Get text for string id
-const char *rini_get_value_text(rini_data data, const char *key)
+// Find section for provided name, returns -1 if not found
+// NOTE: Section NULL or empty refers to global section,
+// sections are usually a few, so a linear scan over names is used
+static int rini_find_section(rini_data data, const char *section)
 {
-    const char *text = NULL;
+    int result = -1;
 
-    for (unsigned int i = 0; i < data.count; i++)
+    if ((section == NULL) || (section[0] == '\0')) result = (data.section_count > 0)? 0 : -1;
+    else
     {
-        if (strcmp(key, data.values[i].key) == 0) // Key found
+        for (unsigned int i = 1; i < data.section_count; i++)
         {
-            text = data.values[i].text;
-            break;
+            if (strcmp(section, data.sections[i].name) == 0) // Section found
+            {
+                result = (int)i;
+                break;
+            }
         }
     }
 
-    return text;
+    return result;
 }
 
-// Get value text for provided key with fallback if not found or not valid
-const char *rini_get_value_text_fallback(rini_data data, const char *key, const char *fallback)
+// Find value position for provided key in section, returns -1 if not found
+// NOTE: Only section values are considered, using section keys index
+static int rini_find_section_key(rini_data data, int section, const char *key)
 {
-    const char *text = fallback;
+    int position = -1;
 
-    for (unsigned int i = 0; i < data.count; i++)
+    if ((section >= 0) && (section < (int)data.section_count))
     {
-        if (strcmp(key, data.values[i].key) == 0) // Key found
-        {
-            text = data.values[i].text;
-            break;
-        }
+        rini_section *sec = &data.sections[section];
+        position = rini_index_find(sec->index, data.values + sec->first, sec->count, key);
+
+        if (position >= 0) position += (int)sec->first;
     }
 
-    return text;
+    return position;
 }
 
-// Get description for string id
-const char *rini_get_value_description(rini_data data, const char *key)
+// Add new section at the end, returns section index or -1 if fails
+// NOTE: Global section (name NULL or empty) has no section line
+static int rini_add_section(rini_data *data, const char *name)
 {
-    const char *desc = NULL;
+    int result = -1;
 
-    for (unsigned int i = 0; i < data.count; i++)
+    if ((data->section_count < data->section_capacity) || rini_grow_sections(data))
     {
-        if (strcmp(key, data.values[i].key) == 0) // Key found
+        rini_section *section = &data->sections[data->section_count];
+        memset(section, 0, sizeof(rini_section));
+        section->name = "";
+        section->first = data->count;
+
+        result = (int)data->section_count;
+        data->section_count++;
+
+        if ((name != NULL) && (name[0] != '\0'))
         {
-            desc = data.values[i].desc;
-            break;
+            // Add section line as section first value: NULL, "name", NULL
+            if (rini_add_value(data, result, data->count, NULL, name, NULL) == 0)
+            {
+                data->values[section->first].is_text = false;
+                data->values[section->first].is_section = true;
+                section->name = data->values[section->first].text;
+            }
+            else
+            {
+                data->section_count--;
+                result = -1;
+            }
         }
     }
 
-    return desc;
+    return result;
 }
 
-// Set comment line
-int rini_set_comment_line(rini_data *data, const char *comment)
+// Add new value into section at provided position, next values are moved
+// NOTE: Comment line is set as: NULL, NULL, "comment"
+static int rini_add_value(rini_data *data, int section, unsigned int position, const char *key, const char *text, const char *desc)
 {
     int result = -1;
 
-    result = rini_set_value_text(data, NULL, NULL, comment);
+    if ((data->count < data->capacity) || rini_grow_values(data))
+    {
+        if (position < data->count)
+        {
+            memmove(&data->values[position + 1], &data->values[position], (data->count - position)*sizeof(rini_value));
+            data->generation++; // Values moved, handles are stale
+        }
+
+        rini_value *value = &data->values[position];
+        memset(value, 0, sizeof(rini_value));
+        value->key = "";
+        value->text = "";
+        value->desc = "";
+
+        // NOTE: Interned data keys are stored once, in intern table
+        int key_id = ((key != NULL) && (data->intern != NULL))? rini_intern_key(data->intern, key) : -1;
+
+        if (key_id >= 0)
+        {
+            value->key = data->intern->keys[key_id];
+            value->key_len = (unsigned int)strlen(value->key);
+        }
+        else if (key != NULL) rini_set_string(data, &value->key, &value->key_len, key);
+        if (text != NULL) rini_set_string(data, &value->text, &value->text_len, text);
+        if (desc != NULL) rini_set_string(data, &value->desc, &value->desc_len, desc);
+
+        value->is_text = true;
+        value->is_dirty = true;     // Not in source file, line must be inserted
+        if (key != NULL) rini_resolve_value(value);
+
+        // Update sections ranges, next sections are moved
+        data->count++;
+        data->sections[section].count++;
+        for (unsigned int i = section + 1; i < data->section_count; i++) data->sections[i].first++;
+
+#if RINI_USE_KEY_HASH_INDEX
+        // Update keys indexes, positions after inserted value are moved (no rebuild)
+        // NOTE: Sections indexes store relative positions, next sections indexes are not affected
+        rini_section *sec = &data->sections[section];
+        if (position < (sec->first + sec->count - 1)) rini_index_shift(&sec->index, position - sec->first);
+        rini_index_add(&sec->index, data->values + sec->first, sec->count, position - sec->first, data->arena);
+
+        if (position < (data->count - 1)) rini_index_shift(&data->index, position);
+        rini_index_add(&data->index, data->values, data->count, position, data->arena);
+#endif
+        // Update interned keys positions, positions after inserted value are moved, new key id is mapped
+        // NOTE: No keys lookup, positions grow geometrically if key id was not mapped yet
+        if (data->intern != NULL)
+        {
+            if (position < (data->count - 1))
+            {
+                for (unsigned int i = 0; i < data->key_position_count; i++) data->key_positions[i] += (data->key_positions[i] > position);
+            }
+
+            if ((key_id >= 0) && (((unsigned int)key_id < data->key_position_count) || rini_intern_reserve(data, (unsigned int)key_id + 1)))
+            {
+                // NOTE: First key found is mapped (same as rini_get_value()), value inserted before a duplicate key replaces it
+                unsigned int mapped = data->key_positions[key_id];
+                if ((mapped == 0) || (mapped > position + 1)) data->key_positions[key_id] = position + 1;
+            }
+        }
+
+        RINI_STATS_ADD(data->stats, appends, 1);
+        result = 0;
+    }
+    else RINI_STATS_ADD(data->stats, truncations, 1);
 
     return result;
 }
 
-// Set value and description for existing key or create a new entry
-int rini_set_value(rini_data *data, const char *key, int value, const char *desc)
+// Update value text and description (if provided)
+// NOTE: Description is updated only if new one provided, previous description is not removed
+static void rini_update_value(rini_data *data, rini_value *value, const char *text, const char *desc)
+{
+    if (text != NULL) rini_set_string(data, &value->text, &value->text_len, text);
+    if (desc != NULL) rini_set_string(data, &value->desc, &value->desc_len, desc);
+
+    if (text != NULL) rini_resolve_value(value);
+    value->is_dirty = true;
+    RINI_STATS_ADD(data->stats, sets, 1);
+}
+
+// Set value entry (text, description and text flag) for existing key or create a new one
+// NOTE: Key is looked-up once, text flag is cleared on updated or added value (typed setters) with no
+// second lookup, text setters keep existing value flag (new values are always text)
+static int rini_set_value_entry(rini_data *data, const char *key, const char *text, const char *desc, bool is_text)
 {
     int result = -1;
-    char value_text[RINI_MAX_TEXT_SIZE] = { 0 };
 
-    snprintf(value_text, RINI_MAX_TEXT_SIZE, "%i", value);
+    if (data->section_count == 0) rini_add_section(data, NULL); // Global section is always required
 
-    result = rini_set_value_text(data, key, value_text, desc);
+    // Try to find key and update text and description
+    int position = rini_find_key(*data, key);
 
-    if (result == 0) // Value set!
+    if (position >= 0) // Key found
     {
-        // NOTE: Key may have already existed and updated, so
-        // need to re-find it to update the flag manually
-        for (unsigned int i = 0; i < data->count; i++)
+        rini_update_value(data, &data->values[position], text, desc);
+        result = 0;
+    }
+    else if (data->section_count > 0)
+    {
+        // Key not found, adding a new entry if possible
+        if ((key == NULL) && (text == NULL))
         {
-            if (strcmp(key, data->values[i].key) == 0) // Key found
-            {
-                data->values[i].is_text = false;
-                break;
-            }
+            position = (int)data->count;
+            result = rini_add_value(data, (int)data->section_count - 1, data->count, NULL, NULL, desc);
+        }
+        else
+        {
+            position = (int)rini_get_section_end(*data, 0);
+            result = rini_add_value(data, 0, (unsigned int)position, key, text, desc);
         }
     }
 
+    if ((result == 0) && !is_text) data->values[position].is_text = false;
+
     return result;
 }
 
-// Set value text and description for existing key or create a new entry
-// NOTE: When setting a text value, if id does not exist, a new entry is automatically created
-int rini_set_value_text(rini_data *data, const char *key, const char *text, const char *desc)
+// Set section value entry (text, description and text flag) for existing key or create a new one
+// NOTE: New values are added after section last value, before trailing comments and empty lines,
+// text flag is managed same as rini_set_value_entry()
+static int rini_set_section_value_entry(rini_data *data, const char *section, const char *key, const char *text, const char *desc, bool is_text)
 {
     int result = -1;
 
-    if (key != NULL)
+    if ((key != NULL) && (key[0] != '\0'))
     {
-        // Try to find key and update text and description
-        for (unsigned int i = 0; i < data->count; i++)
-        {
-            if (strcmp(key, data->values[i].key) == 0) // Key found
-            {
-                memset(data->values[i].text, 0, RINI_MAX_TEXT_SIZE);
-                memcpy(data->values[i].text, text, strlen(text));
-
-                if (desc != NULL)
-                {
-                    // NOTE: Update description only if new one provided,
-                    // do not remove previous description
-                    memset(data->values[i].desc, 0, RINI_MAX_DESC_SIZE);
-                    memcpy(data->values[i].desc, desc, strlen(desc));
-                }
+        if (data->section_count == 0) rini_add_section(data, NULL); // Global section is always required
 
-                result = 0;
-                break;
-            }
-        }
-    }
+        int section_index = rini_find_section(*data, section);
+        if (section_index < 0) section_index = rini_add_section(data, section);
 
-    // Key not found, adding a new entry if possible
-    if (result == -1)
-    {
-        if (data->count < data->capacity)
+        if (section_index >= 0)
         {
-            if ((key == NULL) && (text == NULL)) // Comment line
-            {
-                memset(data->values[data->count].key, 0, RINI_MAX_KEY_SIZE);
-                memset(data->values[data->count].text, 0, RINI_MAX_TEXT_SIZE);
+            int position = rini_find_section_key(*data, section_index, key);
 
-                if (desc != NULL)
-                {
-                    for (int i = 0; (i < RINI_MAX_DESC_SIZE) && (desc[i] != '\0'); i++) data->values[data->count].desc[i] = desc[i];
-                }
-                else memset(data->values[data->count].desc, 0, RINI_MAX_DESC_SIZE);
+            if (position >= 0) // Key found
+            {
+                rini_update_value(data, &data->values[position], text, desc);
+                result = 0;
             }
             else
             {
-                // NOTE: Doing a manual copy to avoid possible overflows on input data
-                for (int i = 0; (i < RINI_MAX_KEY_SIZE) && (key[i] != '\0'); i++) data->values[data->count].key[i] = key[i];
-                for (int i = 0; (i < RINI_MAX_TEXT_SIZE) && (text[i] != '\0'); i++) data->values[data->count].text[i] = text[i];
-                if (desc != NULL) for (int i = 0; (i < RINI_MAX_DESC_SIZE) && (desc[i] != '\0'); i++) data->values[data->count].desc[i] = desc[i];
+                position = (int)rini_get_section_end(*data, section_index);
+                result = rini_add_value(data, section_index, (unsigned int)position, key, text, desc);
             }
 
-            data->values[data->count].is_text = true;
-            data->count++;
-            result = 0;
+            if ((result == 0) && !is_text) data->values[position].is_text = false;
         }
     }
 
     return result;
 }
 
-// Set value description for existing key
-// WARNING: Key must exist to add description, if a description exists, it is updated
-int rini_set_value_description(rini_data *data, const char *key, const char *desc)
+// Grow intern table keys capacity and hash slots (geometrically), returns false if not possible
+// NOTE: Hash slots are kept at least half empty, all keys ids inserted again
+static bool rini_intern_grow(rini_intern *intern)
 {
-    int result = 1;
+    bool result = false;
+    unsigned int capacity = (intern->capacity == 0)? 32 : intern->capacity*2;
+    const char **keys = (const char **)RINI_MALLOC(capacity*sizeof(const char *));
+    unsigned int *slots = (unsigned int *)RINI_CALLOC(capacity*2, sizeof(unsigned int));
+
+    if ((keys != NULL) && (slots != NULL))
+    {
+        if (intern->count > 0) memcpy(keys, intern->keys, intern->count*sizeof(const char *));
+        RINI_FREE(intern->keys);
+        RINI_FREE(intern->slots);
+
+        intern->keys = keys;
+        intern->capacity = capacity;
+        intern->slots = slots;
+        intern->slot_capacity = capacity*2;
+
+        for (unsigned int i = 0; i < intern->count; i++) rini_intern_insert(intern, i);
+        result = true;
+    }
+    else
+    {
+        RINI_FREE(keys);
+        RINI_FREE(slots);
+    }
+
+    return result;
+}
+
+// Insert key id into intern table hash slots
+static void rini_intern_insert(rini_intern *intern, unsigned int key_id)
+{
+    const char *key = intern->keys[key_id];
+    unsigned int mask = intern->slot_capacity - 1;
+    unsigned int slot = (unsigned int)rini_hash_text(key, (unsigned int)strlen(key)) & mask;
+
+    while (intern->slots[slot] != 0) slot = (slot + 1) & mask;
+
+    intern->slots[slot] = key_id + 1;
+}
+
+// Map data interned keys positions by key id, returns false on failure
+// NOTE: Positions array covers all keys interned at mapping time, keys interned later (by other data)
+// are out of range, they are not data keys
+static bool rini_intern_map(rini_data *data)
+{
+    bool result = rini_intern_reserve(data, data->intern->count);
 
-    for (unsigned int i = 0; i < data->count; i++)
+    if (result && (data->key_position_count > 0))
     {
-        if (strcmp(key, data->values[i].key) == 0) // Key found
+        memset(data->key_positions, 0, data->key_position_count*sizeof(unsigned int));
+
+        for (unsigned int i = 0; i < data->count; i++)
         {
-            memset(data->values[i].desc, 0, RINI_MAX_DESC_SIZE);
-            if (desc != NULL) memcpy(data->values[i].desc, desc, strlen(desc));
-            result = 0;
-            break;
+            int key_id = (data->values[i].key_len > 0)? rini_intern_find(*data->intern, data->values[i].key) : -1;
+            if ((key_id >= 0) && (data->key_positions[key_id] == 0)) data->key_positions[key_id] = i + 1;
         }
     }
 
     return result;
 }
 
-//----------------------------------------------------------------------------------
-// Module Internal Functions Declaration
-//----------------------------------------------------------------------------------
-// Get string id from a buffer line containing id-value pair
-static int rini_read_key(const char *buffer, char *key)
+// Reserve data interned keys positions for provided keys ids count, new positions not mapped (0)
+// NOTE: Capacity grows geometrically, so keys added one by one by setters reallocate positions only a few times
+static bool rini_intern_reserve(rini_data *data, unsigned int count)
 {
-    int len = 0;
-    while ((buffer[len] != '\0') && (buffer[len] != ' ') && (buffer[len] != RINI_VALUE_DELIMITER)) len++;    // Skip keyentifier
+    bool result = true;
+
+    if (count > data->key_position_capacity)
+    {
+        unsigned int capacity = (data->key_position_capacity == 0)? 32 : data->key_position_capacity;
+        while (capacity < count) capacity *= 2;
 
-    memcpy(key, buffer, len);
+        unsigned int *positions = (unsigned int *)rini_alloc(data->arena, capacity*sizeof(unsigned int));
 
-    return len;
+        if (positions != NULL)
+        {
+            if (data->key_position_count > 0) memcpy(positions, data->key_positions, data->key_position_count*sizeof(unsigned int));
+
+            rini_free(data->arena, data->key_positions);
+            data->key_positions = positions;
+            data->key_position_capacity = capacity;
+        }
+        else result = false;
+    }
+
+    if (result && (count > data->key_position_count))
+    {
+        memset(data->key_positions + data->key_position_count, 0, (count - data->key_position_count)*sizeof(unsigned int));
+        data->key_position_count = count;
+    }
+
+    return result;
 }
 
-// Get string-value from a buffer line containing id-value pair
-static int rini_read_value_text(const char *buffer, char *text, char *desc, bool *is_text)
+// Get section position to add new values (after section last value)
+// NOTE: For the last section, values are added at the end, for other sections, values are
+// added before section trailing comments and empty lines, usually related to next section
+static unsigned int rini_get_section_end(rini_data data, int section)
 {
-    char *buffer_ptr = (char *)buffer;
+    unsigned int first = data.sections[section].first;
+    unsigned int position = first + data.sections[section].count;
 
-    // Expected line structure:
-    // [key][spaces?][delimiter?][spaces?][quot-mark?][textValue][quot-mark?][spaces?][[;][#]description?]
-    // NOTE: Processing requires skipping spaces, checking for delimiter (if required), skipping more spaces, and get text value
+    if (section < ((int)data.section_count - 1))
+    {
+        while ((position > first) && (data.values[position - 1].key[0] == '\0') && !data.values[position - 1].is_section) position--;
+    }
 
-    while ((buffer_ptr[0] != '\0') && (buffer_ptr[0] != ' ')) buffer_ptr++; // Skip keyentifier
+    return position;
+}
 
-    while ((buffer_ptr[0] != '\0') && (buffer_ptr[0] == ' ')) buffer_ptr++; // Skip line spaces before text value or delimiter
+// Grow sections capacity (geometrically), returns false if not possible
+static bool rini_grow_sections(rini_data *data)
+{
+    bool result = false;
+    unsigned int capacity = (data->section_capacity == 0)? 4 : data->section_capacity*2;
+    rini_section *sections = (rini_section *)rini_alloc(data->arena, capacity*sizeof(rini_section));
 
-#if defined(RINI_VALUE_DELIMITER)
-    if (buffer_ptr[0] == RINI_VALUE_DELIMITER)
+    if (sections != NULL)
     {
-        buffer_ptr++;       // Skip delimiter
+        if (data->section_count > 0) memcpy(sections, data->sections, data->section_count*sizeof(rini_section));
+        rini_free(data->arena, data->sections);
 
-        while ((buffer_ptr[0] != '\0') && (buffer_ptr[0] == ' ')) buffer_ptr++; // Skip line spaces before text value
+        data->sections = sections;
+        data->section_capacity = capacity;
+        result = true;
     }
-#endif
 
-    // Now buffer_ptr should be pointing to the start of value
+    return result;
+}
 
-    int len = 0;
-    while ((buffer_ptr[len] != '\0') &&
-        (buffer_ptr[len] != '\r') &&
-        (buffer_ptr[len] != '\n')) len++; // Get text-value and description length (to the end of line)
+// Find key position in values indexed, returns -1 if not found
+// NOTE: If index is not available, values are looked-up with a linear scan
+static int rini_index_find(rini_index index, const rini_value *values, unsigned int count, const char *key)
+{
+    int position = -1;
 
-    // Now the length from text-value start to end of line is registered
+#if !RINI_USE_KEY_HASH_INDEX
+    (void)index; // Index not used, linear scan
+#endif
 
-    int value_len = len;
-    int desc_pos = 0;
-#if defined(RINI_DESCRIPTION_DELIMITER)
-    // Scan text looking for text-value description (if used)
-    for (; desc_pos < len; desc_pos++)
+    // NOTE: Comment lines and empty lines are never found (empty key)
+    if ((key != NULL) && (key[0] != '\0'))
     {
-        if (buffer_ptr[desc_pos] == RINI_DESCRIPTION_DELIMITER)
+#if RINI_USE_KEY_HASH_INDEX
+        if (index.slots != NULL)
         {
-            value_len = desc_pos - 1;
-            while (buffer_ptr[value_len] == ' ') value_len--;
+            unsigned int mask = index.capacity - 1;
+            unsigned int slot = rini_hash_key(key) & mask;
 
-            value_len++;
+            // Linear probing until key is found or an empty slot is reached
+            while (index.slots[slot] != 0)
+            {
+                // NOTE: Interned keys are usually found by pointer, no string comparison
+                const char *indexed = values[index.slots[slot] - 1].key;
 
-            desc_pos++;   // Skip delimiter and following spaces
-            while (buffer_ptr[desc_pos] == ' ') desc_pos++;
-            break;
+                if ((key == indexed) || (strcmp(key, indexed) == 0)) // Key found
+                {
+                    position = (int)index.slots[slot] - 1;
+                    break;
+                }
+
+                slot = (slot + 1) & mask;
+            }
         }
-    }
+        else
 #endif
+        {
+            for (unsigned int i = 0; i < count; i++)
+            {
+                if (strcmp(key, values[i].key) == 0) // Key found
+                {
+                    position = (int)i;
+                    break;
+                }
+            }
+        }
+    }
 
-#if RINI_USE_TEXT_QUOTATION_MARKS
-    // Remove starting quotation-mark from text (if being used)
-    if (buffer_ptr[0] == RINI_VALUE_QUOTATION_MARKS)
+    return position;
+}
+
+#if RINI_USE_KEY_HASH_INDEX
+// Compute key hash (FNV-1a, 32bit)
+static unsigned int rini_hash_key(const char *key)
+{
+    unsigned int hash = 2166136261u;
+
+    for (int i = 0; key[i] != '\0'; i++)
     {
-        buffer_ptr++; desc_pos--; len--; value_len--;
+        hash ^= (unsigned char)key[i];
+        hash *= 16777619u;
+    }
+
+    return hash;
+}
 
-        // Remove ending quotation-mark from text (if being used)
-        if (buffer_ptr[value_len - 1] == RINI_VALUE_QUOTATION_MARKS) { value_len--; }
+// Build keys hash index for values
+// NOTE: Index capacity is kept as power-of-two and at least twice the values count,
+// so the load factor never exceeds 0.5 and probing sequences remain short
+static void rini_index_build(rini_index *index, const rini_value *values, unsigned int count, rini_arena *arena)
+{
+    unsigned int capacity = 16;
+    while (capacity < count*2) capacity *= 2;
 
-        *is_text = true;
+    // NOTE: Slots are reused if capacity does not change (index rebuilt after values moved)
+    if ((index->slots == NULL) || (index->capacity != capacity))
+    {
+        rini_free(arena, index->slots);
+        index->slots = (unsigned int *)rini_alloc(arena, capacity*sizeof(unsigned int));
     }
-#endif
 
-    // Clear text buffers to be updated
-    memset(text, 0, RINI_MAX_TEXT_SIZE);
-    memset(desc, 0, RINI_MAX_DESC_SIZE);
+    index->capacity = (index->slots != NULL)? capacity : 0;
+    index->count = 0;
 
-    // Copy value-text and description to provided pointers
-    memcpy(text, buffer_ptr, value_len);
-    memcpy(desc, buffer_ptr + desc_pos, ((len - desc_pos) > (RINI_MAX_DESC_SIZE - 1))? (RINI_MAX_DESC_SIZE - 1) : (len - desc_pos));
+    if (index->slots != NULL)
+    {
+        memset(index->slots, 0, capacity*sizeof(unsigned int));
 
-    return len;
+        for (unsigned int i = 0; i < count; i++) rini_index_insert(index, values, i);
+    }
 }
 
-// Convert text to int value (if possible), same as atoi()
-static int rini_text_to_int(const char *text)
+// Insert value position into keys hash index
+// NOTE: Comment lines and empty lines (empty key) are not indexed
+static void rini_index_insert(rini_index *index, const rini_value *values, unsigned int position)
 {
-    int value = 0;
-    int sign = 1;
+    const char *key = values[position].key;
 
-    if ((text[0] == '+') || (text[0] == '-'))
+    if (key[0] != '\0')
     {
-        if (text[0] == '-') sign = -1;
-        text++;
+        unsigned int mask = index->capacity - 1;
+        unsigned int slot = rini_hash_key(key) & mask;
+        bool duplicated = false;
+
+        while (index->slots[slot] != 0)
+        {
+            // In case of duplicate keys, first entry is kept indexed, same as linear scan
+            // NOTE: Value inserted before indexed duplicate (setters) replaces it
+            if (strcmp(key, values[index->slots[slot] - 1].key) == 0)
+            {
+                if (position < (index->slots[slot] - 1)) index->slots[slot] = position + 1;
+                duplicated = true;
+                break;
+            }
+
+            slot = (slot + 1) & mask;
+        }
+
+        if (!duplicated)
+        {
+            index->slots[slot] = position + 1;
+            index->count++;
+        }
     }
+}
 
-    int i = 0;
-    for (; ((text[i] >= '0') && (text[i] <= '9')); i++) value = value*10 + (int)(text[i] - '0');
+// Add value position into keys hash index, index is rebuilt for provided values if required
+static void rini_index_add(rini_index *index, const rini_value *values, unsigned int count, unsigned int position, rini_arena *arena)
+{
+    if ((index->slots == NULL) || ((index->count + 1)*2 > index->capacity)) rini_index_build(index, values, count, arena);
+    else rini_index_insert(index, values, position);
+}
 
-    //if (strlen(text) != i) // Text starts with numbers but contains some text after that...
+// Move indexed positions from provided position, a value has been inserted there (next values moved)
+// NOTE: Slots are only incremented (no keys hashed or compared), inserted value must be added after it,
+// increment is branchless so loop can be vectorized by compiler
+static void rini_index_shift(rini_index *index, unsigned int position)
+{
+    unsigned int *slots = index->slots;
 
-    return value*sign;
+    for (unsigned int i = 0; i < index->capacity; i++) slots[i] += (slots[i] > position);
 }
+#endif
 
 #endif  // RINI_IMPLEMENTATION